@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+void compressedArrays();
+
+// An append-only array of 32-bit unsigned ints stored in compressed blocks.
+//
+// Every full block of kBlockSize values is encoded one of two ways:
+//   - frame of reference: store (value - min) using just enough bits
+//   - delta: for non-decreasing blocks, store (value[i] - value[i-1] - step)
+// whichever needs fewer bits. The packed bits are laid out "vertically" in
+// 4 lanes (value i lives in lane i % 4) so one SIMD register decodes 4
+// consecutive values at a time. The last, partial block stays uncompressed
+// until it fills up.
+class CompressedIntArray {
+public:
+    static constexpr int kBlockSize = 128;
+
+    CompressedIntArray() = default;
+    ~CompressedIntArray();
+
+    CompressedIntArray(const CompressedIntArray&) = delete;
+    CompressedIntArray& operator=(const CompressedIntArray&) = delete;
+
+    void append(std::uint32_t value);
+
+    // Random access. Frame-of-reference blocks unpack one value; delta
+    // blocks add up the gaps before it inside ONE block, 4 per SSE2 add
+    // (at most kBlockSize / 4 adds, never the whole array).
+    std::uint32_t get(int index) const;
+
+    // Decodes block 'block' (full or tail) into out[0 .. blockLength(block)).
+    // Uses SSE2 when the compiler targets it, a scalar loop otherwise.
+    void decodeBlock(int block, std::uint32_t* out) const;
+
+    int size() const { return count_; }
+    int blockCount() const { return (count_ + kBlockSize - 1) / kBlockSize; }
+    int blockLength(int block) const;
+
+    // Bits per value chosen for an encoded block, and whether it used delta.
+    int blockBits(int block) const;
+    bool blockIsDelta(int block) const;
+
+    // Bytes actually holding data: packed words, block headers and the tail.
+    std::size_t bytesUsed() const;
+
+private:
+    struct BlockHeader {
+        std::uint32_t base;  // FOR: block minimum; delta: first value - step
+        std::uint32_t step;  // delta: smallest gap (0 for FOR blocks)
+        int wordOffset;      // first packed word of this block in words_
+        std::uint8_t bits;   // bits per packed value, 0 .. 32
+        bool delta;
+    };
+
+    std::uint32_t* words_ = nullptr;
+    int wordCount_ = 0;
+    int wordCapacity_ = 0;
+
+    BlockHeader* headers_ = nullptr;
+    int headerCount_ = 0;
+    int headerCapacity_ = 0;
+
+    std::uint32_t tail_[kBlockSize] = {};
+    int count_ = 0;
+
+    void encodeTail();
+    std::uint32_t unpack(const BlockHeader& header, int i) const;
+    std::uint32_t sumPacked(const BlockHeader& header, int last) const;
+};
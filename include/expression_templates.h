@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cassert>
+#include <functional>
+
+void expressionTemplates();
+
+// ==================== Parallel evaluation hook ====================
+
+// A parallel backend splits [0, count) into chunks and runs body(begin, end)
+// on each chunk, returning once every chunk has finished.
+using ParallelFor = void (*)(int count, const std::function<void(int, int)>& body);
+
+// Installs the backend used for expressions with at least 'cutoff' elements.
+// Pass nullptr to evaluate everything serially.
+void setParallelEval(ParallelFor backend, int cutoff);
+ParallelFor parallelEvalBackend();
+int parallelEvalCutoff();
+
+// Ready-made backend: one std::thread per hardware core.
+void threadParallelFor(int count, const std::function<void(int, int)>& body);
+
+// ==================== Expression nodes ====================
+
+// Base class for every lazy expression. Derived types provide
+// operator[](i) and size(); nothing is computed until assign() runs.
+template <typename Derived>
+struct ArrayExpr {
+    const Derived& self() const { return static_cast<const Derived&>(*this); }
+};
+
+// Non-owning view of a contiguous buffer: a dynamic array (arr, count) or a
+// flat matrix (flat, rows * cols). Assigning an expression to a view writes
+// through to the underlying elements; it never re-points the view.
+template <typename T>
+class ArrayView : public ArrayExpr<ArrayView<T>> {
+public:
+    using value_type = T;
+
+    ArrayView(T* data, int count) : data_(data), count_(count) {}
+    ArrayView(const ArrayView&) = default;
+
+    T& operator[](int i) const { return data_[i]; }
+    int size() const { return count_; }
+    T* data() const { return data_; }
+
+    ArrayView& operator=(const ArrayView& other) {
+        assign(*this, other);
+        return *this;
+    }
+
+    template <typename E>
+    ArrayView& operator=(const ArrayExpr<E>& expr) {
+        assign(*this, expr);
+        return *this;
+    }
+
+private:
+    T* data_;
+    int count_;
+};
+
+// A single value broadcast to every index; size() is -1 ("any length").
+template <typename T>
+class ScalarExpr : public ArrayExpr<ScalarExpr<T>> {
+public:
+    using value_type = T;
+
+    explicit ScalarExpr(T value) : value_(value) {}
+
+    T operator[](int) const { return value_; }
+    int size() const { return -1; }
+
+private:
+    T value_;
+};
+
+struct AddOp {
+    template <typename T> static T apply(T a, T b) { return a + b; }
+};
+
+struct SubOp {
+    template <typename T> static T apply(T a, T b) { return a - b; }
+};
+
+struct MulOp {
+    template <typename T> static T apply(T a, T b) { return a * b; }
+};
+
+// One element-wise operation. Operands are stored BY VALUE: views and
+// scalars are a pointer or a number, so the whole tree stays small and
+// never dangles when an expression is stored in an 'auto' variable.
+template <typename L, typename R, typename Op>
+class BinaryExpr : public ArrayExpr<BinaryExpr<L, R, Op>> {
+public:
+    using value_type = typename L::value_type;
+
+    BinaryExpr(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {
+        assert(lhs.size() < 0 || rhs.size() < 0 || lhs.size() == rhs.size());
+    }
+
+    value_type operator[](int i) const { return Op::apply(lhs_[i], rhs_[i]); }
+    int size() const { return lhs_.size() >= 0 ? lhs_.size() : rhs_.size(); }
+
+private:
+    L lhs_;
+    R rhs_;
+};
+
+// ==================== Operators ====================
+
+template <typename L, typename R>
+BinaryExpr<L, R, AddOp> operator+(const ArrayExpr<L>& lhs, const ArrayExpr<R>& rhs) {
+    return {lhs.self(), rhs.self()};
+}
+
+template <typename L, typename R>
+BinaryExpr<L, R, SubOp> operator-(const ArrayExpr<L>& lhs, const ArrayExpr<R>& rhs) {
+    return {lhs.self(), rhs.self()};
+}
+
+template <typename L, typename R>
+BinaryExpr<L, R, MulOp> operator*(const ArrayExpr<L>& lhs, const ArrayExpr<R>& rhs) {
+    return {lhs.self(), rhs.self()};
+}
+
+template <typename L>
+BinaryExpr<L, ScalarExpr<typename L::value_type>, AddOp>
+operator+(const ArrayExpr<L>& lhs, typename L::value_type rhs) {
+    return {lhs.self(), ScalarExpr<typename L::value_type>(rhs)};
+}
+
+template <typename L>
+BinaryExpr<L, ScalarExpr<typename L::value_type>, SubOp>
+operator-(const ArrayExpr<L>& lhs, typename L::value_type rhs) {
+    return {lhs.self(), ScalarExpr<typename L::value_type>(rhs)};
+}
+
+template <typename L>
+BinaryExpr<L, ScalarExpr<typename L::value_type>, MulOp>
+operator*(const ArrayExpr<L>& lhs, typename L::value_type rhs) {
+    return {lhs.self(), ScalarExpr<typename L::value_type>(rhs)};
+}
+
+template <typename R>
+BinaryExpr<ScalarExpr<typename R::value_type>, R, MulOp>
+operator*(typename R::value_type lhs, const ArrayExpr<R>& rhs) {
+    return {ScalarExpr<typename R::value_type>(lhs), rhs.self()};
+}
+
+// ==================== Evaluation ====================
+
+// The single fused loop: every operator in the tree inlines into this body,
+// so there are no temporaries and the compiler is free to vectorize it.
+template <typename T, typename E>
+void evaluateRange(const ArrayView<T>& dst, const E& expr, int begin, int end) {
+    T* out = dst.data();
+    for (int i = begin; i < end; ++i) {
+        out[i] = expr[i];
+    }
+}
+
+// dst = expr. Every element only reads index i of its operands, so
+// aliasing like A = A * 2 + B is safe.
+template <typename T, typename E>
+void assign(const ArrayView<T>& dst, const ArrayExpr<E>& expr) {
+    const E& e = expr.self();
+    assert(e.size() < 0 || e.size() == dst.size());
+
+    ParallelFor backend = parallelEvalBackend();
+    if (backend != nullptr && dst.size() >= parallelEvalCutoff()) {
+        backend(dst.size(), [&](int begin, int end) { evaluateRange(dst, e, begin, end); });
+        return;
+    }
+    evaluateRange(dst, e, 0, dst.size());
+}
@@ -0,0 +1,255 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+void flatHashMaps();
+
+// Insert / lookup / erase throughput and memory, FlatHashMap vs
+// std::unordered_map, for 10^3 up to 10^maxPowerOfTen entries.
+void hashMapBenchmark(int maxPowerOfTen);
+
+// An open-addressing hash map in the SwissTable style.
+//
+// Three parallel arrays of 'capacity' slots (capacity is a power of two):
+//   ctrl_   one control byte per slot: kEmpty, kDeleted, or the low 7
+//           bits of the key's hash ("h2") when the slot is full
+//   keys_   the keys, contiguous
+//   values_ the values, contiguous
+// Slots are probed in aligned groups of 16. One SSE2 compare checks all 16
+// control bytes of a group against h2 at once, so keys are only compared
+// for slots that very likely match. Capacity doubles, as in dynamicArrays(),
+// when size + tombstones would pass 7/8 of capacity.
+//
+// K and V must be default-constructible and copy-assignable (slots are
+// allocated with new[], like every other array in this project).
+template <typename K, typename V, typename Hash = std::hash<K>>
+class FlatHashMap {
+public:
+    static constexpr int kGroupSize = 16;
+
+    FlatHashMap() { allocate(kGroupSize); }
+
+    ~FlatHashMap() { release(); }
+
+    FlatHashMap(const FlatHashMap&) = delete;
+    FlatHashMap& operator=(const FlatHashMap&) = delete;
+
+    // Inserts key -> value, or overwrites the value if key is present.
+    // Returns true when a new entry was added.
+    bool insert(const K& key, const V& value) {
+        std::uint64_t hash = mix(key);
+        int slot = findSlot(key, hash);
+        if (slot >= 0) {
+            values_[slot] = value;
+            return false;
+        }
+
+        if ((size_ + deleted_ + 1) * 8 > capacity_ * 7) {
+            // key or value may live in this map (insert(k, *find(j))), and
+            // rehash() frees the old arrays — copy them out first.
+            K keyCopy = key;
+            V valueCopy = value;
+            // Mostly tombstones: clean up in place. Otherwise: double.
+            rehash(size_ * 2 < capacity_ ? capacity_ : capacity_ * 2);
+            place(hash, keyCopy, valueCopy);
+        } else {
+            place(hash, key, value);
+        }
+        return true;
+    }
+
+    // Pointer to the value for key, or nullptr when key is absent.
+    // Unlike std::unordered_map, entries live IN the arrays: any insert
+    // that grows or rehashes the table moves every entry, so pointers from
+    // earlier find() calls must not be used after an insert.
+    V* find(const K& key) {
+        int slot = findSlot(key, mix(key));
+        return slot >= 0 ? &values_[slot] : nullptr;
+    }
+
+    const V* find(const K& key) const {
+        int slot = findSlot(key, mix(key));
+        return slot >= 0 ? &values_[slot] : nullptr;
+    }
+
+    bool contains(const K& key) const { return findSlot(key, mix(key)) >= 0; }
+
+    bool erase(const K& key) {
+        int slot = findSlot(key, mix(key));
+        if (slot < 0) return false;
+
+        // A group with an empty slot ends every probe that reaches it, so
+        // this slot can go straight back to empty. In a full group, a later
+        // key may have probed PAST it — leave a tombstone instead.
+        int group = slot / kGroupSize;
+        ctrl_[slot] = groupHasEmpty(group) ? kEmpty : kDeleted;
+        if (ctrl_[slot] == kDeleted) ++deleted_;
+        keys_[slot] = K();
+        values_[slot] = V();
+        --size_;
+        return true;
+    }
+
+    int size() const { return size_; }
+    int capacity() const { return capacity_; }
+    double loadFactor() const { return static_cast<double>(size_) / capacity_; }
+
+    // Heap bytes for all three arrays.
+    std::size_t bytesAllocated() const {
+        return static_cast<std::size_t>(capacity_) * (1 + sizeof(K) + sizeof(V));
+    }
+
+private:
+    static constexpr std::int8_t kEmpty = -128;   // 0b10000000
+    static constexpr std::int8_t kDeleted = -2;   // 0b11111110
+
+    std::int8_t* ctrl_ = nullptr;
+    K* keys_ = nullptr;
+    V* values_ = nullptr;
+    int capacity_ = 0;
+    int size_ = 0;
+    int deleted_ = 0;
+
+    // std::hash<int> is often the identity; stir the bits so both the
+    // group index (high bits) and h2 (low 7 bits) look random.
+    static std::uint64_t mix(const K& key) {
+        std::uint64_t h = static_cast<std::uint64_t>(Hash()(key));
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    static std::int8_t h2(std::uint64_t hash) { return static_cast<std::int8_t>(hash & 0x7F); }
+
+    int groupCount() const { return capacity_ / kGroupSize; }
+    int firstGroup(std::uint64_t hash) const { return static_cast<int>((hash >> 7) & (groupCount() - 1)); }
+
+    // Bit i set when control byte i of 'group' equals 'tag'.
+    unsigned matchTag(int group, std::int8_t tag) const {
+        const std::int8_t* bytes = ctrl_ + group * kGroupSize;
+#if defined(__SSE2__)
+        __m128i ctrl = _mm_load_si128(reinterpret_cast<const __m128i*>(bytes));
+        return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(tag))));
+#else
+        unsigned mask = 0;
+        for (int i = 0; i < kGroupSize; ++i) {
+            if (bytes[i] == tag) mask |= 1u << i;
+        }
+        return mask;
+#endif
+    }
+
+    // Bit i set when slot i is empty or deleted (both have the top bit set).
+    unsigned matchFree(int group) const {
+        const std::int8_t* bytes = ctrl_ + group * kGroupSize;
+#if defined(__SSE2__)
+        __m128i ctrl = _mm_load_si128(reinterpret_cast<const __m128i*>(bytes));
+        return static_cast<unsigned>(_mm_movemask_epi8(ctrl));
+#else
+        unsigned mask = 0;
+        for (int i = 0; i < kGroupSize; ++i) {
+            if (bytes[i] < 0) mask |= 1u << i;
+        }
+        return mask;
+#endif
+    }
+
+    bool groupHasEmpty(int group) const { return matchTag(group, kEmpty) != 0; }
+
+    // Slot holding key, or -1. Groups are visited at offsets 0, 1, 3, 6, ...
+    // (triangular numbers), which reaches every group when the group count
+    // is a power of two.
+    int findSlot(const K& key, std::uint64_t hash) const {
+        int groups = groupCount();
+        int group = firstGroup(hash);
+        std::int8_t tag = h2(hash);
+        for (int step = 1; step <= groups; ++step) {
+            for (unsigned mask = matchTag(group, tag); mask != 0; mask &= mask - 1) {
+                int slot = group * kGroupSize + std::countr_zero(mask);
+                if (keys_[slot] == key) return slot;
+            }
+            if (groupHasEmpty(group)) return -1;
+            group = (group + step) & (groups - 1);
+        }
+        return -1;
+    }
+
+    // First empty or deleted slot on key's probe path (there always is one:
+    // the load factor stays below 7/8).
+    int freeSlot(std::uint64_t hash) const {
+        int groups = groupCount();
+        int group = firstGroup(hash);
+        for (int step = 1;; ++step) {
+            unsigned mask = matchFree(group);
+            if (mask != 0) return group * kGroupSize + std::countr_zero(mask);
+            group = (group + step) & (groups - 1);
+        }
+    }
+
+    void allocate(int capacity) {
+        // 16-byte aligned so each group loads with one aligned SSE2 load
+        ctrl_ = new (std::align_val_t(kGroupSize)) std::int8_t[capacity];
+        for (int i = 0; i < capacity; ++i) {
+            ctrl_[i] = kEmpty;
+        }
+        keys_ = new K[capacity];
+        values_ = new V[capacity];
+        capacity_ = capacity;
+        size_ = 0;
+        deleted_ = 0;
+    }
+
+    void release() {
+        ::operator delete[](ctrl_, std::align_val_t(kGroupSize));
+        delete[] keys_;
+        delete[] values_;
+        ctrl_ = nullptr;
+        keys_ = nullptr;
+        values_ = nullptr;
+    }
+
+    // Writes a new entry into the first free slot on its probe path.
+    void place(std::uint64_t hash, const K& key, const V& value) {
+        int slot = freeSlot(hash);
+        if (ctrl_[slot] == kDeleted) --deleted_;
+        ctrl_[slot] = h2(hash);
+        keys_[slot] = key;
+        values_[slot] = value;
+        ++size_;
+    }
+
+    // Allocate the new arrays, re-insert every live entry, delete the old
+    // arrays. Entries move to new slots (the group depends on capacity), so
+    // unlike dynamicArrays() this is a re-insert rather than a straight copy.
+    void rehash(int newCapacity) {
+        std::int8_t* oldCtrl = ctrl_;
+        K* oldKeys = keys_;
+        V* oldValues = values_;
+        int oldCapacity = capacity_;
+
+        allocate(newCapacity);
+        for (int i = 0; i < oldCapacity; ++i) {
+            if (oldCtrl[i] >= 0) {
+                std::uint64_t hash = mix(oldKeys[i]);
+                int slot = freeSlot(hash);
+                ctrl_[slot] = h2(hash);
+                keys_[slot] = oldKeys[i];
+                values_[slot] = oldValues[i];
+                ++size_;
+            }
+        }
+
+        ::operator delete[](oldCtrl, std::align_val_t(kGroupSize));
+        delete[] oldKeys;
+        delete[] oldValues;
+    }
+};
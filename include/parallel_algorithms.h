@@ -0,0 +1,331 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+void parallelAlgorithms();
+
+// ==================== Thread pool ====================
+
+// A fixed set of worker threads that run "chunked" jobs: body(chunk) for
+// every chunk in [0, chunks). The calling thread works on chunks too, and
+// run() returns only once every chunk is done. A run() issued from inside
+// a running job executes serially, so algorithms may nest safely.
+class ThreadPool {
+public:
+    explicit ThreadPool(int workers);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Threads that take part in a job: the workers plus the caller.
+    int concurrency() const { return static_cast<int>(workers_.size()) + 1; }
+
+    void run(int chunks, const std::function<void(int)>& body);
+
+    // One pool for the whole process, sized to the hardware.
+    static ThreadPool& shared();
+
+private:
+    std::vector<std::thread> workers_;
+    std::mutex runMutex_;  // one job at a time
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(int)>* body_ = nullptr;
+    int chunks_ = 0;
+    int nextChunk_ = 0;
+    int pending_ = 0;
+    long long generation_ = 0;
+    bool stopping_ = false;
+
+    void workerLoop();
+    void drainChunks(std::unique_lock<std::mutex>& lock);
+};
+
+// Inputs with fewer elements than this run serially: waking threads costs
+// more than sorting or scanning a few thousand ints.
+void setParallelCutoff(int cutoff);
+int parallelCutoff();
+
+// ParallelFor-compatible adapter (see expression_templates.h), so the
+// shared pool can also evaluate large expressions:
+//   setParallelEval(poolParallelFor, cutoff);
+void poolParallelFor(int count, const std::function<void(int, int)>& body);
+
+// Splits [0, count) into 'chunks' nearly equal pieces.
+inline int chunkBegin(int count, int chunks, int chunk) {
+    return static_cast<int>(static_cast<long long>(count) * chunk / chunks);
+}
+
+// ==================== Prefix sums ====================
+
+// out[i] = in[0] + ... + in[i] (inclusive) or init + in[0] + ... + in[i-1]
+// (exclusive). in and out may be the same array.
+//   Phase 1: each chunk sums its own elements (parallel)
+//   Phase 2: exclusive scan of those few chunk sums (serial)
+//   Phase 3: each chunk scans itself starting from its offset (parallel)
+template <typename T>
+void parallelScan(const T* in, T* out, int count, T init, bool inclusive,
+                  ThreadPool& pool = ThreadPool::shared()) {
+    auto scanRange = [&](int begin, int end, T running) {
+        for (int i = begin; i < end; ++i) {
+            T value = in[i];
+            if (!inclusive) out[i] = running;
+            running = running + value;
+            if (inclusive) out[i] = running;
+        }
+    };
+
+    if (count < parallelCutoff() || pool.concurrency() == 1) {
+        scanRange(0, count, init);
+        return;
+    }
+
+    int chunks = pool.concurrency();
+    std::unique_ptr<T[]> sums(new T[chunks]);
+    pool.run(chunks, [&](int chunk) {
+        T sum = T{};
+        for (int i = chunkBegin(count, chunks, chunk); i < chunkBegin(count, chunks, chunk + 1); ++i) {
+            sum = sum + in[i];
+        }
+        sums[chunk] = sum;
+    });
+
+    T running = init;
+    for (int chunk = 0; chunk < chunks; ++chunk) {
+        T sum = sums[chunk];
+        sums[chunk] = running;
+        running = running + sum;
+    }
+
+    pool.run(chunks, [&](int chunk) {
+        scanRange(chunkBegin(count, chunks, chunk), chunkBegin(count, chunks, chunk + 1), sums[chunk]);
+    });
+}
+
+template <typename T>
+void parallelInclusiveScan(const T* in, T* out, int count, ThreadPool& pool = ThreadPool::shared()) {
+    parallelScan(in, out, count, T{}, true, pool);
+}
+
+template <typename T>
+void parallelExclusiveScan(const T* in, T* out, int count, T init = T{},
+                           ThreadPool& pool = ThreadPool::shared()) {
+    parallelScan(in, out, count, init, false, pool);
+}
+
+// ==================== Partition / filter ====================
+
+// Stable partition into a pre-sized output buffer of 'count' elements:
+// every element with pred(x) true, in order, then every other element, in
+// order. Returns how many passed. Each chunk counts its passes, an
+// exclusive scan of those counts gives every chunk its write position,
+// then all chunks write at once without touching each other's slots.
+template <typename T, typename Pred>
+int parallelPartition(const T* in, T* out, int count, Pred pred, bool keepRejected = true,
+                      ThreadPool& pool = ThreadPool::shared()) {
+    int chunks = (count < parallelCutoff()) ? 1 : pool.concurrency();
+    std::unique_ptr<int[]> passed(new int[chunks]);
+    std::unique_ptr<int[]> passOffset(new int[chunks + 1]);  // last entry = total
+
+    pool.run(chunks, [&](int chunk) {
+        int n = 0;
+        for (int i = chunkBegin(count, chunks, chunk); i < chunkBegin(count, chunks, chunk + 1); ++i) {
+            if (pred(in[i])) ++n;
+        }
+        passed[chunk] = n;
+    });
+
+    parallelExclusiveScan(passed.get(), passOffset.get(), chunks, 0, pool);
+    int total = passOffset[chunks - 1] + passed[chunks - 1];
+    passOffset[chunks] = total;
+
+    pool.run(chunks, [&](int chunk) {
+        int begin = chunkBegin(count, chunks, chunk);
+        int yes = passOffset[chunk];
+        int no = total + (begin - passOffset[chunk]);  // rejects before this chunk
+        for (int i = begin; i < chunkBegin(count, chunks, chunk + 1); ++i) {
+            if (pred(in[i])) {
+                out[yes++] = in[i];
+            } else if (keepRejected) {
+                out[no++] = in[i];
+            }
+        }
+    });
+    return total;
+}
+
+// Writes only the elements with pred(x) true; returns how many.
+template <typename T, typename Pred>
+int parallelFilter(const T* in, T* out, int count, Pred pred, ThreadPool& pool = ThreadPool::shared()) {
+    return parallelPartition(in, out, count, pred, false, pool);
+}
+
+// ==================== Sorting ====================
+
+// LSD radix sort for integer keys, one byte per pass (stable).
+//   Per pass: each chunk counts its 256 digit buckets (parallel); an
+//   exclusive scan over (digit, chunk) pairs gives each chunk its private
+//   write position per digit (serial, 256 * chunks entries); then every
+//   chunk scatters its elements (parallel).
+template <typename T>
+void parallelRadixSort(T* data, int count, ThreadPool& pool = ThreadPool::shared()) {
+    static_assert(std::is_integral_v<T>, "radix sort needs integer keys");
+    using Key = std::make_unsigned_t<T>;
+    // Flipping the sign bit makes signed order match unsigned byte order
+    constexpr Key kFlip = std::is_signed_v<T> ? Key(Key(1) << (sizeof(T) * 8 - 1)) : Key(0);
+
+    if (count < 2) return;
+    if (count < parallelCutoff()) {
+        std::sort(data, data + count);
+        return;
+    }
+
+    int chunks = pool.concurrency();
+    std::unique_ptr<T[]> buffer(new T[count]);
+    std::unique_ptr<int[]> offsets(new int[256 * chunks]);
+    T* from = data;
+    T* to = buffer.get();
+
+    for (int pass = 0; pass < static_cast<int>(sizeof(T)); ++pass) {
+        int shift = pass * 8;
+        auto digit = [&](T value) {
+            return static_cast<int>(((static_cast<Key>(value) ^ kFlip) >> shift) & 0xFF);
+        };
+
+        pool.run(chunks, [&](int chunk) {
+            int* histogram = offsets.get() + chunk * 256;
+            for (int d = 0; d < 256; ++d) histogram[d] = 0;
+            for (int i = chunkBegin(count, chunks, chunk); i < chunkBegin(count, chunks, chunk + 1); ++i) {
+                ++histogram[digit(from[i])];
+            }
+        });
+
+        int running = 0;
+        for (int d = 0; d < 256; ++d) {
+            for (int chunk = 0; chunk < chunks; ++chunk) {
+                int n = offsets[chunk * 256 + d];
+                offsets[chunk * 256 + d] = running;
+                running += n;
+            }
+        }
+
+        pool.run(chunks, [&](int chunk) {
+            int* position = offsets.get() + chunk * 256;
+            for (int i = chunkBegin(count, chunks, chunk); i < chunkBegin(count, chunks, chunk + 1); ++i) {
+                to[position[digit(from[i])]++] = from[i];
+            }
+        });
+
+        std::swap(from, to);
+    }
+
+    // Each pass flips buffers; an odd pass count (1-byte keys) ends in the copy
+    if (from != data) {
+        std::copy(from, from + count, data);
+    }
+}
+
+// How many of the first k outputs of std::merge(a[0..m), b[0..n)) come
+// from a. Binary search on the split point: taking a[i] is right while
+// a[i] <= b[j - 1] (ties go to a, as in std::merge, which keeps it stable).
+template <typename T, typename Compare>
+int mergeSplit(const T* a, int m, const T* b, int n, int k, Compare& comp) {
+    int lo = std::max(0, k - n);
+    int hi = std::min(k, m);
+    while (lo < hi) {
+        int i = lo + (hi - lo) / 2;
+        if (!comp(b[k - i - 1], a[i])) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+// Stable merge sort for any movable T: each chunk is sorted on its own
+// thread, then neighbouring runs are merged pairwise, halving the run count
+// each round, ping-ponging between 'data' and one scratch buffer. When a
+// round has fewer merges than threads, each merge is cut into equal output
+// pieces with mergeSplit(), so even the last merge uses every thread.
+// Elements are moved, never copied, and the scratch buffer is raw storage,
+// so T needs no default constructor.
+template <typename T, typename Compare = std::less<>>
+void parallelMergeSort(T* data, int count, Compare comp = Compare(),
+                       ThreadPool& pool = ThreadPool::shared()) {
+    if (count < parallelCutoff() || pool.concurrency() == 1) {
+        std::stable_sort(data, data + count, comp);
+        return;
+    }
+
+    // Sorted runs are moved into the buffer, which constructs its elements
+    std::allocator<T> allocator;
+    T* buffer = allocator.allocate(count);
+    int runs = pool.concurrency();
+    pool.run(runs, [&](int run) {
+        int begin = chunkBegin(count, runs, run);
+        int end = chunkBegin(count, runs, run + 1);
+        std::stable_sort(data + begin, data + end, comp);
+        std::uninitialized_move(data + begin, data + end, buffer + begin);
+    });
+
+    T* from = buffer;
+    T* to = data;
+    std::unique_ptr<int[]> aSplit(new int[runs + 1]);
+    for (int width = 1; width < runs; width *= 2) {
+        int pairs = (runs + 2 * width - 1) / (2 * width);
+        int pieces = std::max(1, runs / pairs);
+
+        // Piece p of a pair writes outputs [first, last) of that merge
+        auto bounds = [&](int task, int& begin, int& middle, int& end, int& first, int& last) {
+            int lo = task / pieces * 2 * width;
+            begin = chunkBegin(count, runs, lo);
+            middle = chunkBegin(count, runs, std::min(lo + width, runs));
+            end = chunkBegin(count, runs, std::min(lo + 2 * width, runs));
+            first = chunkBegin(end - begin, pieces, task % pieces);
+            last = chunkBegin(end - begin, pieces, task % pieces + 1);
+        };
+
+        // Split points first (a few binary searches): once pieces start
+        // moving elements out of 'from', they can no longer be compared.
+        for (int task = 0; task < pairs * pieces; ++task) {
+            int begin, middle, end, first, last;
+            bounds(task, begin, middle, end, first, last);
+            aSplit[task] = mergeSplit(from + begin, middle - begin, from + middle, end - middle, first, comp);
+        }
+
+        pool.run(pairs * pieces, [&](int task) {
+            int begin, middle, end, first, last;
+            bounds(task, begin, middle, end, first, last);
+            int aFirst = aSplit[task];
+            int aLast = (task % pieces == pieces - 1) ? middle - begin : aSplit[task + 1];
+            std::merge(std::make_move_iterator(from + begin + aFirst),
+                       std::make_move_iterator(from + begin + aLast),
+                       std::make_move_iterator(from + middle + (first - aFirst)),
+                       std::make_move_iterator(from + middle + (last - aLast)),
+                       to + begin + first, comp);
+        });
+        std::swap(from, to);
+    }
+
+    pool.run(runs, [&](int run) {
+        int begin = chunkBegin(count, runs, run);
+        int end = chunkBegin(count, runs, run + 1);
+        if (from != data) {
+            std::move(from + begin, from + end, data + begin);
+        }
+        std::destroy(buffer + begin, buffer + end);
+    });
+    allocator.deallocate(buffer, count);
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <string>
+
+void performanceCounters();
+
+// What one measured region cost. Counters that could not be opened are -1;
+// if none could be opened, countersAvailable is false and only the
+// wall-clock time is meaningful.
+struct PerfReport {
+    std::string name;
+    double milliseconds = 0.0;
+    bool countersAvailable = false;
+
+    long long cycles = -1;
+    long long instructions = -1;
+    long long l1dMisses = -1;
+    long long llcMisses = -1;
+    long long dtlbMisses = -1;
+    long long branchMisses = -1;
+
+    // Instructions per cycle, or -1 when either counter is missing.
+    double ipc() const;
+};
+
+// Scales a multiplexed count up to the whole region: the kernel counted
+// 'value' while the event was running, out of 'enabled' nanoseconds.
+// Returns -1 when the event never ran, since there is nothing to scale.
+long long scaledCount(unsigned long long value, unsigned long long enabled,
+                      unsigned long long running);
+
+// Hardware performance counters for the calling thread (Linux
+// perf_event_open). Counters are opened once in the constructor and
+// reused by every start()/stop() pair. Cycles and instructions form one
+// event group, so the kernel always schedules them together and ipc()
+// compares counts from the same time window. On other platforms, or when
+// the kernel refuses (containers, perf_event_paranoid), it times regions only.
+class PerfCounters {
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const { return openCount_ > 0; }
+
+    // Why counters are unavailable (empty when they are available).
+    const std::string& unavailableReason() const { return unavailableReason_; }
+
+    void start();
+    PerfReport stop(const std::string& name);
+
+private:
+    static constexpr int kEventCount = 6;
+
+    int fds_[kEventCount] = {-1, -1, -1, -1, -1, -1};
+    int openCount_ = 0;
+    bool instructionsGrouped_ = false;  // fds_[1] follows leader fds_[0]
+    std::string unavailableReason_;
+    long long startNanos_ = 0;
+
+    void controlAll(unsigned long request);
+};
+
+// Runs body() between start() and stop() and returns the report.
+template <typename Body>
+PerfReport measureRegion(PerfCounters& counters, const std::string& name, Body&& body) {
+    counters.start();
+    body();
+    return counters.stop(name);
+}
+
+// Prints one report as a single aligned line, so several reports line up
+// as a table.
+void printPerfReport(const PerfReport& report);
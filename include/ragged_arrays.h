@@ -0,0 +1,165 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <utility>
+
+void raggedArrays();
+
+// A jagged 2D array stored as ONE values buffer plus a prefix-sum index.
+//   values  = [ row 0 | row 1 | row 2 | ... ]   (all rows back to back)
+//   offsets = [ 0, len0, len0+len1, ... ]       (rowCount + 1 entries)
+// Row r lives at values[offsets[r]] up to (not including) values[offsets[r + 1]].
+// Both buffers grow with the same doubling strategy as dynamicArrays().
+template <typename T>
+class RaggedArray {
+public:
+    RaggedArray() = default;
+
+    // Bulk-build from the int** "spine + rows" form. Sizes are known up
+    // front, so each buffer is allocated exactly once.
+    RaggedArray(T* const* rows, const int* rowLengths, int rowCount) {
+        int total = 0;
+        for (int r = 0; r < rowCount; ++r) {
+            total += rowLengths[r];
+        }
+        reserve(total, rowCount);
+        for (int r = 0; r < rowCount; ++r) {
+            appendRow(rows[r], rowLengths[r]);
+        }
+    }
+
+    ~RaggedArray() {
+        delete[] values_;
+        delete[] offsets_;
+    }
+
+    // Copying would silently duplicate two heap buffers; moves are cheap.
+    RaggedArray(const RaggedArray&) = delete;
+    RaggedArray& operator=(const RaggedArray&) = delete;
+
+    RaggedArray(RaggedArray&& other) noexcept { swap(other); }
+
+    RaggedArray& operator=(RaggedArray&& other) noexcept {
+        if (this != &other) {
+            RaggedArray gone(std::move(*this));
+            swap(other);
+        }
+        return *this;
+    }
+
+    // Builder: copies 'length' values onto the end of the values buffer
+    // and records where the new row ends. 'row' may point into this array
+    // (e.g. appendRow(row(0))): growing frees the old buffer, so such a row
+    // is re-located by its offset afterwards.
+    void appendRow(const T* row, int length) {
+        growOffsets(rowCount_ + 2);
+        std::less<const T*> before;
+        bool aliased = !before(row, values_) && before(row, values_ + valueCount_);
+        std::ptrdiff_t start = aliased ? row - values_ : 0;
+        growValues(valueCount_ + length);
+        if (aliased) {
+            row = values_ + start;
+        }
+        for (int i = 0; i < length; ++i) {
+            values_[valueCount_ + i] = row[i];
+        }
+        valueCount_ += length;
+        ++rowCount_;
+        offsets_[rowCount_] = valueCount_;
+    }
+
+    void appendRow(std::span<const T> row) {
+        appendRow(row.data(), static_cast<int>(row.size()));
+    }
+
+    // O(1): two offset reads, no pointer chase into a separate row block.
+    std::span<T> row(int r) {
+        return {values_ + offsets_[r], static_cast<std::size_t>(rowLength(r))};
+    }
+
+    std::span<const T> row(int r) const {
+        return {values_ + offsets_[r], static_cast<std::size_t>(rowLength(r))};
+    }
+
+    int rowLength(int r) const { return offsets_[r + 1] - offsets_[r]; }
+    int rowCount() const { return rowCount_; }
+    int valueCount() const { return valueCount_; }
+    int valueCapacity() const { return valueCapacity_; }
+    int offsetCapacity() const { return offsetCapacity_; }
+
+    // Heap bytes held by both buffers (used + spare capacity).
+    std::size_t bytesAllocated() const {
+        return static_cast<std::size_t>(valueCapacity_) * sizeof(T) +
+               static_cast<std::size_t>(offsetCapacity_) * sizeof(int);
+    }
+
+    // Makes room for 'values' values across 'rows' rows without any
+    // further resizes.
+    void reserve(int values, int rows) {
+        resizeValues(values);
+        resizeOffsets(rows + 1);
+    }
+
+private:
+    T* values_ = nullptr;
+    int* offsets_ = nullptr;
+    int valueCount_ = 0;
+    int valueCapacity_ = 0;
+    int rowCount_ = 0;
+    int offsetCapacity_ = 0;
+
+    static int doubledCapacity(int capacity, int needed) {
+        int newCapacity = capacity == 0 ? 4 : capacity;
+        while (newCapacity < needed) {
+            newCapacity *= 2;
+        }
+        return newCapacity;
+    }
+
+    void growValues(int needed) {
+        if (needed > valueCapacity_) {
+            resizeValues(doubledCapacity(valueCapacity_, needed));
+        }
+    }
+
+    void growOffsets(int needed) {
+        if (needed > offsetCapacity_) {
+            resizeOffsets(doubledCapacity(offsetCapacity_, needed));
+        }
+    }
+
+    // Same allocate / copy / delete-old steps as dynamicArrays().
+    void resizeValues(int newCapacity) {
+        if (newCapacity <= valueCapacity_) return;
+        T* newValues = new T[newCapacity];
+        for (int i = 0; i < valueCount_; ++i) {
+            newValues[i] = values_[i];
+        }
+        delete[] values_;
+        values_ = newValues;
+        valueCapacity_ = newCapacity;
+    }
+
+    void resizeOffsets(int newCapacity) {
+        if (newCapacity <= offsetCapacity_) return;
+        int* newOffsets = new int[newCapacity];
+        newOffsets[0] = 0;
+        for (int i = 1; i <= rowCount_; ++i) {
+            newOffsets[i] = offsets_[i];
+        }
+        delete[] offsets_;
+        offsets_ = newOffsets;
+        offsetCapacity_ = newCapacity;
+    }
+
+    void swap(RaggedArray& other) noexcept {
+        std::swap(values_, other.values_);
+        std::swap(offsets_, other.offsets_);
+        std::swap(valueCount_, other.valueCount_);
+        std::swap(valueCapacity_, other.valueCapacity_);
+        std::swap(rowCount_, other.rowCount_);
+        std::swap(offsetCapacity_, other.offsetCapacity_);
+    }
+};
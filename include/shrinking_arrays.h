@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+
+void shrinkingArrays();
+
+// When and how a ShrinkableArray gives memory back.
+struct ShrinkPolicy {
+    // Halve capacity once count < capacity * lowWaterRatio. Must be below
+    // 0.5 so a halved array is never full (no grow/shrink thrashing);
+    // 0 disables shrinking entirely (the grow-only behaviour of dynamicArrays()).
+    double lowWaterRatio = 0.25;
+
+    // Never shrink below this many elements.
+    int minCapacity = 4;
+
+    // Buffers of at least this many bytes are mmap'd page-aligned, and
+    // shrinking them returns the unused tail pages with madvise instead of
+    // allocating a smaller block and copying. 0 disables (always copy).
+    std::size_t madviseMinBytes = std::size_t{1} << 20;
+
+    // MADV_FREE lets the kernel reclaim lazily (cheaper, RSS drops only
+    // under pressure); the default MADV_DONTNEED releases immediately.
+    bool useMadvFree = false;
+};
+
+// The count/capacity int array from dynamicArrays(), plus a shrink policy.
+// Every live array registers itself so trimAllArrays() can reach it.
+class ShrinkableArray {
+public:
+    explicit ShrinkableArray(ShrinkPolicy policy = ShrinkPolicy());
+    ~ShrinkableArray();
+
+    // The registry holds 'this', so arrays stay put.
+    ShrinkableArray(const ShrinkableArray&) = delete;
+    ShrinkableArray& operator=(const ShrinkableArray&) = delete;
+
+    void push(int value);
+    void pop();
+    void clear();
+
+    // Shrinks capacity all the way down to count (at least minCapacity),
+    // ignoring the low-water mark. Returns the bytes given back.
+    std::size_t trim();
+
+    int operator[](int i) const { return data_[i]; }
+    int count() const { return count_; }
+    int capacity() const { return capacity_; }
+
+    // Bytes of capacity backed by memory: capacity rounded up to whole
+    // pages for mmap'd buffers. Pages past capacity were madvise'd away.
+    std::size_t committedBytes() const;
+
+    // True when the buffer is mmap'd and shrinks with madvise.
+    bool isMapped() const { return mapped_; }
+
+private:
+    ShrinkPolicy policy_;
+    int* data_ = nullptr;
+    int count_ = 0;
+    int capacity_ = 0;
+    int reserved_ = 0;  // elements actually allocated (>= capacity_)
+    bool mapped_ = false;
+
+    void reallocate(int newCapacity);
+    void shrinkTo(int newCapacity);
+    void maybeShrink();
+};
+
+// Process-wide memory-pressure hook: trims every live ShrinkableArray.
+// Arrays are not locked individually, so call it from the thread that owns
+// them (or while they are otherwise idle). Returns the bytes given back.
+std::size_t trimAllArrays();
+
+int registeredArrayCount();
+
+// Resident set size of this process from /proc/self/statm, or -1 if unknown.
+long long currentRssBytes();
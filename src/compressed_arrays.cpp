@@ -0,0 +1,433 @@
+#include "compressed_arrays.h"
+
+#include <bit>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// ==================== CompressedIntArray ====================
+
+// Helper: grows a raw buffer to hold at least 'needed' elements by doubling
+template <typename T>
+static void growBuffer(T*& data, int count, int& capacity, int needed) {
+    if (needed <= capacity) return;
+    int newCapacity = capacity == 0 ? 4 : capacity;
+    while (newCapacity < needed) {
+        newCapacity *= 2;
+    }
+    T* newData = new T[newCapacity];
+    for (int i = 0; i < count; ++i) {
+        newData[i] = data[i];
+    }
+    delete[] data;
+    data = newData;
+    capacity = newCapacity;
+}
+
+static std::uint32_t lowMask(int bits) {
+    return bits == 32 ? 0xFFFFFFFFu : (1u << bits) - 1u;
+}
+
+CompressedIntArray::~CompressedIntArray() {
+    delete[] words_;
+    delete[] headers_;
+}
+
+void CompressedIntArray::append(std::uint32_t value) {
+    tail_[count_ % kBlockSize] = value;
+    ++count_;
+    if (count_ % kBlockSize == 0) {
+        encodeTail();
+    }
+}
+
+void CompressedIntArray::encodeTail() {
+    const std::uint32_t* values = tail_;
+
+    std::uint32_t minValue = values[0];
+    std::uint32_t maxValue = values[0];
+    bool nonDecreasing = true;
+    std::uint32_t minGap = 0xFFFFFFFFu;
+    std::uint32_t maxGap = 0;
+    for (int i = 1; i < kBlockSize; ++i) {
+        if (values[i] < minValue) minValue = values[i];
+        if (values[i] > maxValue) maxValue = values[i];
+        if (values[i] < values[i - 1]) {
+            nonDecreasing = false;
+        } else {
+            std::uint32_t gap = values[i] - values[i - 1];
+            if (gap < minGap) minGap = gap;
+            if (gap > maxGap) maxGap = gap;
+        }
+    }
+
+    BlockHeader header{};
+    header.wordOffset = wordCount_;
+    int forBits = std::bit_width(maxValue - minValue);
+    int deltaBits = nonDecreasing ? std::bit_width(maxGap - minGap) : 33;
+
+    std::uint32_t packed[kBlockSize];
+    if (deltaBits < forBits) {
+        header.delta = true;
+        header.bits = static_cast<std::uint8_t>(deltaBits);
+        header.step = minGap;
+        header.base = values[0] - minGap;
+        packed[0] = 0;
+        for (int i = 1; i < kBlockSize; ++i) {
+            packed[i] = values[i] - values[i - 1] - minGap;
+        }
+    } else {
+        header.delta = false;
+        header.bits = static_cast<std::uint8_t>(forBits);
+        header.step = 0;
+        header.base = minValue;
+        for (int i = 0; i < kBlockSize; ++i) {
+            packed[i] = values[i] - minValue;
+        }
+    }
+
+    // Each of the 4 lanes holds 32 values * bits = 'bits' words, so the
+    // block takes exactly 4 * bits words. Word w of lane j is stored at
+    // words_[wordOffset + w * 4 + j], interleaving the lanes.
+    int bits = header.bits;
+    int blockWords = 4 * bits;
+    growBuffer(words_, wordCount_, wordCapacity_, wordCount_ + blockWords);
+    std::uint32_t* out = words_ + wordCount_;
+    for (int w = 0; w < blockWords; ++w) {
+        out[w] = 0;
+    }
+    for (int i = 0; i < kBlockSize && bits > 0; ++i) {
+        int lane = i & 3;
+        int bitOffset = (i >> 2) * bits;
+        int word = bitOffset >> 5;
+        int shift = bitOffset & 31;
+        out[word * 4 + lane] |= packed[i] << shift;
+        if (shift + bits > 32) {
+            out[(word + 1) * 4 + lane] |= packed[i] >> (32 - shift);
+        }
+    }
+    wordCount_ += blockWords;
+
+    growBuffer(headers_, headerCount_, headerCapacity_, headerCount_ + 1);
+    headers_[headerCount_] = header;
+    ++headerCount_;
+}
+
+std::uint32_t CompressedIntArray::unpack(const BlockHeader& header, int i) const {
+    int bits = header.bits;
+    if (bits == 0) return 0;
+    const std::uint32_t* in = words_ + header.wordOffset;
+    int lane = i & 3;
+    int bitOffset = (i >> 2) * bits;
+    int word = bitOffset >> 5;
+    int shift = bitOffset & 31;
+    std::uint32_t value = in[word * 4 + lane] >> shift;
+    if (shift + bits > 32) {
+        value |= in[(word + 1) * 4 + lane] << (32 - shift);
+    }
+    return value & lowMask(bits);
+}
+
+std::uint32_t CompressedIntArray::get(int index) const {
+    int block = index / kBlockSize;
+    int i = index % kBlockSize;
+    if (block == headerCount_) {
+        return tail_[i];
+    }
+
+    const BlockHeader& header = headers_[block];
+    if (!header.delta) {
+        return header.base + unpack(header, i);
+    }
+    // Value i = value 0 + i steps + gaps 1..i. packed[0] is 0 and base is
+    // value 0 minus one step, so that is base + (i + 1) * step + gaps 0..i.
+    return header.base + static_cast<std::uint32_t>(i + 1) * header.step + sumPacked(header, i);
+}
+
+#if defined(__SSE2__)
+// Helper: packed values 4k .. 4k+3 of a block, one per lane
+static __m128i loadGroup(const __m128i* in, int k, int bits, __m128i mask) {
+    if (bits == 0) return _mm_setzero_si128();
+    int bitOffset = k * bits;
+    int word = bitOffset >> 5;
+    int shift = bitOffset & 31;
+    __m128i v = _mm_srl_epi32(_mm_loadu_si128(in + word), _mm_cvtsi32_si128(shift));
+    if (shift + bits > 32) {
+        __m128i high = _mm_loadu_si128(in + word + 1);
+        v = _mm_or_si128(v, _mm_sll_epi32(high, _mm_cvtsi32_si128(32 - shift)));
+    }
+    return _mm_and_si128(v, mask);
+}
+#endif
+
+std::uint32_t CompressedIntArray::sumPacked(const BlockHeader& header, int last) const {
+    if (header.bits == 0) return 0;
+#if defined(__SSE2__)
+    // Whole groups of 4 add straight into 4 running lanes; the group
+    // holding 'last' keeps only lanes 0 .. last % 4.
+    const __m128i* in = reinterpret_cast<const __m128i*>(words_ + header.wordOffset);
+    __m128i mask = _mm_set1_epi32(static_cast<int>(lowMask(header.bits)));
+    __m128i total = _mm_setzero_si128();
+    int lastGroup = last / 4;
+    for (int k = 0; k < lastGroup; ++k) {
+        total = _mm_add_epi32(total, loadGroup(in, k, header.bits, mask));
+    }
+    __m128i keep = _mm_cmplt_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(last % 4 + 1));
+    total = _mm_add_epi32(total, _mm_and_si128(loadGroup(in, lastGroup, header.bits, mask), keep));
+    total = _mm_add_epi32(total, _mm_shuffle_epi32(total, 0x4E));  // lanes + lanes 2 apart
+    total = _mm_add_epi32(total, _mm_shuffle_epi32(total, 0xB1));  // + neighbour
+    return static_cast<std::uint32_t>(_mm_cvtsi128_si32(total));
+#else
+    std::uint32_t total = 0;
+    for (int i = 0; i <= last; ++i) {
+        total += unpack(header, i);
+    }
+    return total;
+#endif
+}
+
+void CompressedIntArray::decodeBlock(int block, std::uint32_t* out) const {
+    if (block == headerCount_) {
+        for (int i = 0; i < blockLength(block); ++i) {
+            out[i] = tail_[i];
+        }
+        return;
+    }
+
+    const BlockHeader& header = headers_[block];
+    int bits = header.bits;
+
+#if defined(__SSE2__)
+    // ! DISCUSSION: Why the vertical (4-lane) layout pays off here
+    //   Values 4k, 4k+1, 4k+2, 4k+3 sit at the SAME bit position in four
+    //   neighbouring words, so one load + one shift + one mask pulls out
+    //   four consecutive values. No per-value branching at all.
+    const __m128i* in = reinterpret_cast<const __m128i*>(words_ + header.wordOffset);
+    __m128i mask = _mm_set1_epi32(static_cast<int>(lowMask(bits)));
+    __m128i base = _mm_set1_epi32(static_cast<int>(header.base));
+    __m128i step = _mm_set1_epi32(static_cast<int>(header.step));
+    __m128i carry = base;  // delta: running total, broadcast to all lanes
+
+    for (int k = 0; k < kBlockSize / 4; ++k) {
+        __m128i v = loadGroup(in, k, bits, mask);
+
+        if (header.delta) {
+            // In-register prefix sum of the 4 gaps, then add the running total
+            v = _mm_add_epi32(v, step);
+            v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+            v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+            v = _mm_add_epi32(v, carry);
+            carry = _mm_shuffle_epi32(v, 0xFF);
+        } else {
+            v = _mm_add_epi32(v, base);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4 * k), v);
+    }
+#else
+    std::uint32_t running = header.base;
+    for (int i = 0; i < kBlockSize; ++i) {
+        if (header.delta) {
+            running += unpack(header, i) + header.step;
+            out[i] = running;
+        } else {
+            out[i] = header.base + unpack(header, i);
+        }
+    }
+#endif
+}
+
+int CompressedIntArray::blockLength(int block) const {
+    if (block < headerCount_) return kBlockSize;
+    return count_ - headerCount_ * kBlockSize;
+}
+
+int CompressedIntArray::blockBits(int block) const {
+    return block < headerCount_ ? headers_[block].bits : 32;
+}
+
+bool CompressedIntArray::blockIsDelta(int block) const {
+    return block < headerCount_ && headers_[block].delta;
+}
+
+std::size_t CompressedIntArray::bytesUsed() const {
+    std::size_t tailCount = static_cast<std::size_t>(count_ - headerCount_ * kBlockSize);
+    return static_cast<std::size_t>(wordCount_) * sizeof(std::uint32_t) +
+           static_cast<std::size_t>(headerCount_) * sizeof(BlockHeader) +
+           tailCount * sizeof(std::uint32_t);
+}
+
+// ==================== Demo ====================
+
+// Helper: milliseconds elapsed since 'start'
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Helper: prints one block's encoding
+void printBlock(const CompressedIntArray& arr, int block) {
+    std::cout << "  Block " << block << ": "
+              << (arr.blockLength(block) < CompressedIntArray::kBlockSize
+                      ? "raw tail"
+                      : (arr.blockIsDelta(block) ? "delta" : "frame of reference"))
+              << ", " << arr.blockBits(block) << " bits per value, "
+              << arr.blockLength(block) << " values" << '\n';
+}
+
+// Benchmarks one data set: compression, full scan and random access
+static void benchmarkDataSet(const char* name, const std::uint32_t* raw, int n) {
+    CompressedIntArray packed;
+    for (int i = 0; i < n; ++i) {
+        packed.append(raw[i]);
+    }
+
+    int passes = 10;
+    std::uint32_t block[CompressedIntArray::kBlockSize];
+
+    unsigned long long rawSum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        for (int i = 0; i < n; ++i) rawSum += raw[i];
+    }
+    double rawScanMs = elapsedMs(start);
+
+    unsigned long long packedSum = 0;
+    start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        for (int b = 0; b < packed.blockCount(); ++b) {
+            packed.decodeBlock(b, block);
+            int length = packed.blockLength(b);
+            for (int i = 0; i < length; ++i) packedSum += block[i];
+        }
+    }
+    double packedScanMs = elapsedMs(start);
+
+    // Random indices from a fixed-seed LCG so every run probes the same slots
+    int probes = 100000;
+    std::uint32_t seed = 12345;
+    unsigned long long rawProbe = 0;
+    start = std::chrono::steady_clock::now();
+    for (int p = 0; p < probes; ++p) {
+        seed = seed * 1664525u + 1013904223u;
+        rawProbe += raw[seed % static_cast<std::uint32_t>(n)];
+    }
+    double rawProbeMs = elapsedMs(start);
+
+    seed = 12345;
+    unsigned long long packedProbe = 0;
+    start = std::chrono::steady_clock::now();
+    for (int p = 0; p < probes; ++p) {
+        seed = seed * 1664525u + 1013904223u;
+        packedProbe += packed.get(static_cast<int>(seed % static_cast<std::uint32_t>(n)));
+    }
+    double packedProbeMs = elapsedMs(start);
+
+    double scannedBytes = static_cast<double>(n) * sizeof(std::uint32_t) * passes;
+    std::size_t rawBytes = static_cast<std::size_t>(n) * sizeof(std::uint32_t);
+
+    std::ostringstream report;
+    report.precision(2);
+    report << std::fixed;
+    report << name << ": " << rawBytes << " -> " << packed.bytesUsed() << " bytes ("
+           << static_cast<double>(rawBytes) / packed.bytesUsed() << "x)" << '\n';
+    report << "  Scan GB/s:      raw " << scannedBytes / (rawScanMs * 1e6)
+           << ", compressed " << scannedBytes / (packedScanMs * 1e6) << '\n';
+    report << "  Random get ns:  raw " << rawProbeMs * 1e6 / probes
+           << ", compressed " << packedProbeMs * 1e6 / probes << '\n';
+    report << "  " << (rawSum == packedSum && rawProbe == packedProbe ? "Decoded values match"
+                                                                      : "Decoded values DIFFER")
+           << '\n';
+    std::cout << report.str();
+}
+
+void compressedArrays() {
+    std::cout << "\n=== Compressed Integer Arrays (Bit-Packing) ===" << '\n';
+
+    // ! DISCUSSION: Most ints don't need 32 bits
+    //   dynamicArrays() stored 10, 20, 30, ... in 32-bit ints. The values
+    //   differ by exactly 10 each time, so once we know the first value and
+    //   the step, there is NOTHING left to store. Real data is often like
+    //   this: IDs that go up by small amounts, counters under 100, etc.
+    //   Bit-packing stores each value in only as many bits as it needs.
+
+    // --- 1. Encoding a block ---
+    std::cout << "\n--- 1. Encoding Blocks ---" << '\n';
+
+    CompressedIntArray arr;
+    for (int i = 1; i <= CompressedIntArray::kBlockSize; ++i) {
+        arr.append(static_cast<std::uint32_t>(i * 10));  // 10, 20, 30, ...
+    }
+    for (int i = 0; i < CompressedIntArray::kBlockSize; ++i) {
+        arr.append(static_cast<std::uint32_t>(i % 5));  // small counters
+    }
+    arr.append(7);
+    arr.append(8);
+
+    // ! DISCUSSION: Two ways to shrink a block of 128 values
+    //   Frame of reference: subtract the block minimum, so 1000..1007 is
+    //     stored as 0..7 — 3 bits each.
+    //   Delta: for values that never go down, store the GAPS instead. A
+    //     constant gap (10, 20, 30, ...) costs 0 bits per value!
+    //   The encoder tries both and keeps whichever needs fewer bits.
+
+    for (int b = 0; b < arr.blockCount(); ++b) {
+        printBlock(arr, b);
+    }
+    std::cout << "Compressed size: " << arr.size() * sizeof(std::uint32_t)
+              << " -> " << arr.bytesUsed() << " bytes" << '\n';
+
+    // --- 2. Random access ---
+    std::cout << "\n--- 2. Random Access ---" << '\n';
+
+    // ! DISCUSSION: Finding value i without decoding everything
+    //   Block = i / 128, position = i % 128. Every value in a block uses the
+    //   same number of bits, so its bits start at position * bits — pure
+    //   arithmetic, like the flat array's row * cols + col.
+
+    std::cout << "get(0)=" << arr.get(0) << ", get(127)=" << arr.get(127)
+              << ", get(131)=" << arr.get(131) << ", get(257)=" << arr.get(257) << '\n';
+
+    // --- 3. Decoding a whole block ---
+    std::cout << "\n--- 3. Block Decode (SIMD) ---" << '\n';
+
+    std::uint32_t decoded[CompressedIntArray::kBlockSize];
+    arr.decodeBlock(0, decoded);
+    std::cout << "Block 0 starts: " << decoded[0] << " " << decoded[1] << " " << decoded[2]
+              << " " << decoded[3] << " " << decoded[4] << '\n';
+#if defined(__SSE2__)
+    std::cout << "Decoder: SSE2 (4 values per instruction)" << '\n';
+#else
+    std::cout << "Decoder: scalar" << '\n';
+#endif
+
+    // --- 4. Benchmarks ---
+    std::cout << "\n--- 4. Compressed vs Plain int Buffer ---" << '\n';
+
+    int n = 1 << 18;
+    std::uint32_t* ids = new std::uint32_t[n];
+    std::uint32_t* counters = new std::uint32_t[n];
+    std::uint32_t id = 1000000;
+    for (int i = 0; i < n; ++i) {
+        id += 1 + (static_cast<std::uint32_t>(i) * 2654435761u >> 29);  // gaps of 1..8
+        ids[i] = id;
+        counters[i] = (static_cast<std::uint32_t>(i) * 40503u >> 7) % 100;  // 0..99
+    }
+
+    benchmarkDataSet("Monotonic IDs", ids, n);
+    benchmarkDataSet("Small counters", counters, n);
+
+    delete[] ids;
+    delete[] counters;
+    ids = nullptr;
+    counters = nullptr;
+
+    // ! DISCUSSION: Reading the numbers
+    //   Compression ratio is exact. Scan speed is reported in decoded
+    //   (uncompressed) GB/s so the two columns are comparable. Random
+    //   access costs more than arr[i] — that's the price of fewer bytes,
+    //   and it is worst for delta blocks, which add up gaps to find a value.
+}
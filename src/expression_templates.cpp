@@ -0,0 +1,276 @@
+#include "expression_templates.h"
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// ==================== Parallel evaluation hook ====================
+
+static ParallelFor gParallelBackend = nullptr;
+static int gParallelCutoff = 1 << 16;
+
+void setParallelEval(ParallelFor backend, int cutoff) {
+    gParallelBackend = backend;
+    gParallelCutoff = cutoff;
+}
+
+ParallelFor parallelEvalBackend() {
+    return gParallelBackend;
+}
+
+int parallelEvalCutoff() {
+    return gParallelCutoff;
+}
+
+void threadParallelFor(int count, const std::function<void(int, int)>& body) {
+    int workers = static_cast<int>(std::thread::hardware_concurrency());
+    if (workers < 1) workers = 1;
+    if (workers > count) workers = count;
+    if (workers <= 1) {
+        body(0, count);
+        return;
+    }
+
+    int chunk = (count + workers - 1) / workers;
+    std::vector<std::thread> threads;
+    for (int begin = chunk; begin < count; begin += chunk) {
+        int end = begin + chunk < count ? begin + chunk : count;
+        threads.emplace_back(body, begin, end);
+    }
+    body(0, chunk);  // the calling thread takes the first chunk
+    for (std::thread& t : threads) {
+        t.join();
+    }
+}
+
+// ==================== Demo ====================
+
+// Helper: prints the contents of an array view
+void printView(const ArrayView<int>& view) {
+    std::cout << "  [";
+    for (int i = 0; i < view.size(); ++i) {
+        std::cout << view[i];
+        if (i < view.size() - 1) std::cout << ", ";
+    }
+    std::cout << "]" << '\n';
+}
+
+// Helper: milliseconds elapsed since 'start'
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Eager helpers: each returns a brand-new heap array (a "temporary")
+static int* eagerScale(const int* a, int scale, int count) {
+    int* out = new int[count];
+    for (int i = 0; i < count; ++i) out[i] = a[i] * scale;
+    return out;
+}
+
+static int* eagerAdd(const int* a, const int* b, int count) {
+    int* out = new int[count];
+    for (int i = 0; i < count; ++i) out[i] = a[i] + b[i];
+    return out;
+}
+
+static int* eagerSub(const int* a, const int* b, int count) {
+    int* out = new int[count];
+    for (int i = 0; i < count; ++i) out[i] = a[i] - b[i];
+    return out;
+}
+
+void expressionTemplates() {
+    std::cout << "\n=== Expression Templates (Fused Element-Wise Math) ===" << '\n';
+
+    // ! DISCUSSION: The problem with "one function per operation"
+    //   To compute C = A * 2 + B - D over plain arrays, the obvious code is
+    //     int* t1 = scale(A, 2);    // temporary array #1
+    //     int* t2 = add(t1, B);     // temporary array #2
+    //     int* t3 = sub(t2, D);     // temporary array #3 (becomes C)
+    //   Three new[] calls, three full passes over memory, and two delete[]
+    //   calls — for what is really ONE loop: C[i] = A[i] * 2 + B[i] - D[i].
+
+    // --- 1. Eager evaluation with temporaries ---
+    std::cout << "\n--- 1. Eager Evaluation (Temporaries) ---" << '\n';
+
+    int count = 5;
+    int a[] = {1, 2, 3, 4, 5};
+    int b[] = {10, 20, 30, 40, 50};
+    int d[] = {1, 1, 1, 1, 1};
+
+    int* t1 = eagerScale(a, 2, count);
+    int* t2 = eagerAdd(t1, b, count);
+    int* eager = eagerSub(t2, d, count);
+    delete[] t1;
+    delete[] t2;
+
+    std::cout << "Eager result (3 temporary arrays):";
+    printView(ArrayView<int>(eager, count));
+
+    // --- 2. Lazy expressions ---
+    std::cout << "\n--- 2. Lazy Expression (One Fused Loop) ---" << '\n';
+
+    // ! DISCUSSION: Operators that return a RECIPE instead of a result
+    //   With expression templates, A * 2 does not compute anything. It
+    //   returns a tiny object that remembers "A, times 2". Adding B wraps
+    //   that in another object, and so on. The whole formula becomes a
+    //   TYPE like BinaryExpr<BinaryExpr<BinaryExpr<...>>>.
+    //   Only when we assign it to C does a single loop run, asking the
+    //   tree for element i — and the compiler inlines the whole tree.
+
+    ArrayView<int> A(a, count);
+    ArrayView<int> B(b, count);
+    ArrayView<int> D(d, count);
+
+    int* c = new int[count];
+    ArrayView<int> C(c, count);
+
+    auto recipe = A * 2 + B - D;
+    std::cout << "Recipe built: size=" << recipe.size() << ", " << sizeof(recipe)
+              << " bytes, nothing computed yet" << '\n';
+
+    C = recipe;
+    std::cout << "C = A * 2 + B - D:";
+    printView(C);
+
+    bool same = true;
+    for (int i = 0; i < count; ++i) {
+        if (c[i] != eager[i]) same = false;
+    }
+    std::cout << (same ? "Matches eager result" : "DIFFERS from eager result") << '\n';
+
+    delete[] eager;
+    eager = nullptr;
+    delete[] c;
+    c = nullptr;
+
+    // --- 3. Flat matrices are just arrays ---
+    std::cout << "\n--- 3. Flat Matrix Expressions ---" << '\n';
+
+    // ! DISCUSSION: Why this works for 2D too
+    //   A flat rows * cols matrix is one contiguous block, so element-wise
+    //   math does not care about rows at all: view it as rows * cols ints.
+    //   (The int** layout could not do this — each row is its own block.)
+
+    int rows = 3;
+    int cols = 4;
+    int* flat = new int[rows * cols];
+    for (int r = 0; r < rows; ++r) {
+        for (int col = 0; col < cols; ++col) {
+            flat[r * cols + col] = (r * cols) + col + 1;
+        }
+    }
+
+    ArrayView<int> M(flat, rows * cols);
+    M = M * 10 - M;  // in place: each element only reads its own index
+
+    std::cout << "M = M * 10 - M:" << '\n';
+    for (int r = 0; r < rows; ++r) {
+        std::cout << "  Row " << r << ": ";
+        for (int col = 0; col < cols; ++col) {
+            std::cout << flat[r * cols + col] << " ";
+        }
+        std::cout << '\n';
+    }
+
+    delete[] flat;
+    flat = nullptr;
+
+    // --- 4. Eager vs fused vs parallel ---
+    std::cout << "\n--- 4. Eager vs Fused vs Parallel ---" << '\n';
+
+    // ! DISCUSSION: Memory traffic, counted by hand
+    //   Eager:  scale reads 1 array, writes 1; add reads 2, writes 1;
+    //           sub reads 2, writes 1  ->  8 arrays' worth of traffic.
+    //   Fused:  reads A, B, D once and writes C once -> 4 arrays.
+    //   For big arrays the loop is limited by memory bandwidth, not math,
+    //   so halving the traffic is what makes the fused loop faster.
+
+    int n = 1 << 18;
+    int passes = 10;
+    int* bigA = new int[n];
+    int* bigB = new int[n];
+    int* bigD = new int[n];
+    int* bigC = new int[n];
+    for (int i = 0; i < n; ++i) {
+        bigA[i] = i;
+        bigB[i] = i % 7;
+        bigD[i] = i % 3;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        int* s1 = eagerScale(bigA, 2, n);
+        int* s2 = eagerAdd(s1, bigB, n);
+        int* s3 = eagerSub(s2, bigD, n);
+        delete[] s1;
+        delete[] s2;
+        delete[] bigC;
+        bigC = s3;
+    }
+    double eagerMs = elapsedMs(start);
+    long long eagerSum = 0;
+    for (int i = 0; i < n; ++i) eagerSum += bigC[i];
+
+    ArrayView<int> bigAv(bigA, n);
+    ArrayView<int> bigBv(bigB, n);
+    ArrayView<int> bigDv(bigD, n);
+    ArrayView<int> bigCv(bigC, n);
+
+    ParallelFor savedBackend = parallelEvalBackend();
+    int savedCutoff = parallelEvalCutoff();
+
+    setParallelEval(nullptr, savedCutoff);
+    start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        bigCv = bigAv * 2 + bigBv - bigDv;
+    }
+    double fusedMs = elapsedMs(start);
+    long long fusedSum = 0;
+    for (int i = 0; i < n; ++i) fusedSum += bigC[i];
+
+    setParallelEval(threadParallelFor, 1 << 16);
+    start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        bigCv = bigAv * 2 + bigBv - bigDv;
+    }
+    double parallelMs = elapsedMs(start);
+    long long parallelSum = 0;
+    for (int i = 0; i < n; ++i) parallelSum += bigC[i];
+
+    setParallelEval(savedBackend, savedCutoff);
+
+    // Estimated traffic: one load per input read plus one store per result
+    // element (see the DISCUSSION below for what this leaves out).
+    long long arrayBytes = static_cast<long long>(n) * sizeof(int);
+    std::cout << "Elements: " << n << " (" << passes << " passes)" << '\n';
+    std::cout << "Eager:    " << 3 * passes << " temporaries, ~"
+              << 8 * arrayBytes << " bytes moved per pass (estimate), " << eagerMs << " ms" << '\n';
+    std::cout << "Fused:    0 temporaries, ~"
+              << 4 * arrayBytes << " bytes moved per pass (estimate), " << fusedMs << " ms" << '\n';
+    std::cout << "Parallel: 0 temporaries, ~"
+              << 4 * arrayBytes << " bytes moved per pass (estimate), " << parallelMs << " ms" << '\n';
+    bool sumsMatch = eagerSum == fusedSum && fusedSum == parallelSum;
+    std::cout << (sumsMatch ? "All three results match" : "Results DIFFER") << '\n';
+
+    delete[] bigA;
+    delete[] bigB;
+    delete[] bigD;
+    delete[] bigC;
+    bigA = bigB = bigD = bigC = nullptr;
+
+    // ! DISCUSSION: The byte counts are a lower bound
+    //   They count only the loads and stores the code asks for. Each eager
+    //   temporary is brand-new memory, so the real cost is higher: the CPU
+    //   reads every cache line before writing it (write-allocate) and the
+    //   OS zero-fills fresh pages on first touch. measureRegion() in
+    //   performance_counters.cpp reports LLC misses to see this directly.
+
+    // ! DISCUSSION: When does the parallel hook pay off?
+    //   Starting threads costs microseconds, so tiny arrays stay serial:
+    //   only expressions with at least parallelEvalCutoff() elements are
+    //   handed to the backend. Build in Release to see the fused loop
+    //   vectorize — Debug builds keep every tiny operator[] call.
+}
@@ -0,0 +1,202 @@
+#include "flat_hash_maps.h"
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+
+// ==================== Measuring std::unordered_map's memory ====================
+
+static std::size_t gNodeBytes = 0;
+
+// Allocator that adds up every byte std::unordered_map asks for: the
+// bucket array plus one heap node per element.
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(std::size_t n) {
+        gNodeBytes += n * sizeof(T);
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        gNodeBytes -= n * sizeof(T);
+        ::operator delete(p);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U>&) const { return true; }
+};
+
+using CountedUnorderedMap =
+    std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, CountingAllocator<std::pair<const int, int>>>;
+
+// ==================== Benchmark ====================
+
+// Helper: milliseconds elapsed since 'start'
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Distinct keys in scrambled order: multiplying by an odd constant is a
+// one-to-one mapping on 32-bit values. Keys n..2n-1 are never inserted.
+static int benchKey(int i) {
+    return static_cast<int>(static_cast<unsigned>(i) * 2654435761u);
+}
+
+struct MapTimings {
+    double insertMs = 0;
+    double hitMs = 0;
+    double missMs = 0;
+    double eraseMs = 0;
+    std::size_t bytes = 0;
+    long long checksum = 0;
+};
+
+static MapTimings timeFlatHashMap(int n) {
+    MapTimings t;
+    FlatHashMap<int, int> map;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) map.insert(benchKey(i), i);
+    t.insertMs = elapsedMs(start);
+    t.bytes = map.bytesAllocated();
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) t.checksum += *map.find(benchKey(i));
+    t.hitMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = n; i < 2 * n; ++i) t.checksum += map.contains(benchKey(i)) ? 1 : 0;
+    t.missMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) t.checksum += map.erase(benchKey(i)) ? 1 : 0;
+    t.eraseMs = elapsedMs(start);
+    return t;
+}
+
+static MapTimings timeUnorderedMap(int n) {
+    MapTimings t;
+    std::size_t bytesBefore = gNodeBytes;
+    CountedUnorderedMap map;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) map.insert_or_assign(benchKey(i), i);
+    t.insertMs = elapsedMs(start);
+    t.bytes = gNodeBytes - bytesBefore;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) t.checksum += map.find(benchKey(i))->second;
+    t.hitMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = n; i < 2 * n; ++i) t.checksum += map.count(benchKey(i));
+    t.missMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) t.checksum += static_cast<long long>(map.erase(benchKey(i)));
+    t.eraseMs = elapsedMs(start);
+    return t;
+}
+
+void hashMapBenchmark(int maxPowerOfTen) {
+    std::ostringstream report;
+    report.precision(1);
+    report << std::fixed;
+
+    // Million operations per second
+    auto mops = [](int n, double ms) { return ms > 0 ? n / (ms * 1000.0) : 0.0; };
+
+    bool allMatch = true;
+    int n = 100;
+    for (int power = 3; power <= maxPowerOfTen; ++power) {
+        n *= 10;
+        MapTimings flat = timeFlatHashMap(n);
+        MapTimings node = timeUnorderedMap(n);
+        allMatch = allMatch && flat.checksum == node.checksum;
+
+        report << "n=10^" << power << " (Mops/s: insert / hit / miss / erase, bytes)" << '\n';
+        report << "  FlatHashMap:        " << mops(n, flat.insertMs) << " / " << mops(n, flat.hitMs)
+               << " / " << mops(n, flat.missMs) << " / " << mops(n, flat.eraseMs) << ", "
+               << flat.bytes << " bytes" << '\n';
+        report << "  std::unordered_map: " << mops(n, node.insertMs) << " / " << mops(n, node.hitMs)
+               << " / " << mops(n, node.missMs) << " / " << mops(n, node.eraseMs) << ", "
+               << node.bytes << " bytes" << '\n';
+    }
+    std::cout << report.str();
+    std::cout << (allMatch ? "Both maps agree on every operation" : "Maps DISAGREE") << '\n';
+}
+
+// ==================== Demo ====================
+
+void flatHashMaps() {
+    std::cout << "\n=== Flat Hash Maps (Open Addressing) ===" << '\n';
+
+    // ! DISCUSSION: Why not std::unordered_map?
+    //   std::unordered_map allocates a separate heap node for EVERY entry
+    //   and links them into buckets — the int** spine problem again: lots
+    //   of small allocations and a pointer chase on every lookup.
+    //   A flat map stores keys and values directly in arrays, and grows
+    //   those arrays with the same doubling rule as dynamicArrays().
+
+    // --- 1. Inserting and finding ---
+    std::cout << "\n--- 1. Insert and Find ---" << '\n';
+
+    FlatHashMap<int, int> ages;
+    ages.insert(10, 100);
+    ages.insert(20, 200);
+    ages.insert(30, 300);
+    std::cout << "Size: " << ages.size() << ", capacity: " << ages.capacity() << '\n';
+    std::cout << "find(20): " << *ages.find(20) << '\n';
+    std::cout << "find(40): " << (ages.find(40) == nullptr ? "not found" : "found") << '\n';
+    bool added = ages.insert(20, 250);
+    std::cout << "insert(20, 250) " << (added ? "added" : "updated") << ": find(20)=" << *ages.find(20) << '\n';
+
+    // ! DISCUSSION: How a lookup works
+    //   The key's hash picks a starting GROUP of 16 slots, and its low 7
+    //   bits become a 1-byte "tag". Every slot has a control byte holding
+    //   its tag (or EMPTY / DELETED). One SSE2 instruction compares all 16
+    //   control bytes with our tag; only the slots that match get their
+    //   key compared. If the group has an EMPTY slot, the key can't be
+    //   further along, so the search stops.
+
+    // --- 2. Growing by doubling ---
+    std::cout << "\n--- 2. Growing (Doubling at 7/8 Full) ---" << '\n';
+
+    FlatHashMap<int, int> growing;
+    for (int i = 1; i <= 14; ++i) growing.insert(i, i * i);
+    std::cout << "After 14 inserts: size=" << growing.size() << ", capacity=" << growing.capacity() << '\n';
+    growing.insert(15, 225);
+    std::cout << "After 15 inserts: size=" << growing.size() << ", capacity=" << growing.capacity() << '\n';
+    std::cout << "find(12) after growing: " << *growing.find(12) << '\n';
+
+    // ! DISCUSSION: Why grow before it's full?
+    //   An open-addressing table that's nearly full has long probe
+    //   sequences: lookups for missing keys must scan until they hit an
+    //   EMPTY slot. Capping the load at 7/8 keeps probes short.
+
+    // --- 3. Erasing ---
+    std::cout << "\n--- 3. Erase ---" << '\n';
+
+    std::cout << "erase(10): " << (ages.erase(10) ? "erased" : "missing") << '\n';
+    std::cout << "erase(10) again: " << (ages.erase(10) ? "erased" : "missing") << '\n';
+    std::cout << "Size: " << ages.size() << ", find(30): " << *ages.find(30) << '\n';
+
+    // --- 4. Benchmarks ---
+    std::cout << "\n--- 4. FlatHashMap vs std::unordered_map ---" << '\n';
+
+    // ! DISCUSSION: Reading the numbers
+    //   Bytes for std::unordered_map are measured with a counting allocator
+    //   (bucket array + one node per entry). The demo stops at 10^5 to stay
+    //   quick; hashMapBenchmark(8) runs the full sweep on a machine with a
+    //   few GB of free memory.
+
+    hashMapBenchmark(5);
+}
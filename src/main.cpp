@@ -1,7 +1,14 @@
 #include <iostream>
 
+#include "compressed_arrays.h"
 #include "dynamic_arrays.h"
+#include "expression_templates.h"
+#include "flat_hash_maps.h"
 #include "new_and_delete.h"
+#include "parallel_algorithms.h"
+#include "performance_counters.h"
+#include "ragged_arrays.h"
+#include "shrinking_arrays.h"
 #include "two_dimensional_arrays.h"
 
 int main() {
@@ -17,6 +24,27 @@ int main() {
     // Topic 3: Two dimensional arrays
     twoDimensionalArrays();
 
+    // Topic 4: Ragged arrays (values buffer + offsets)
+    raggedArrays();
+
+    // Topic 5: Expression templates (fused element-wise math)
+    expressionTemplates();
+
+    // Topic 6: Compressed integer arrays (bit-packing + delta)
+    compressedArrays();
+
+    // Topic 7: Measuring layouts with hardware performance counters
+    performanceCounters();
+
+    // Topic 8: Shrinking arrays (hysteresis + madvise)
+    shrinkingArrays();
+
+    // Topic 9: Parallel algorithms (sort, scan, partition)
+    parallelAlgorithms();
+
+    // Topic 10: Flat hash maps (open addressing on doubling arrays)
+    flatHashMaps();
+
     std::cout << "\n======================================================" << '\n';
     std::cout << "CT6 Complete!" << '\n';
 
@@ -0,0 +1,272 @@
+#include "parallel_algorithms.h"
+
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+
+#if __has_include(<execution>)
+#include <execution>
+#endif
+
+// ==================== ThreadPool ====================
+
+// True while this thread is running a chunk, so nested run() calls go serial
+static thread_local bool tInsideJob = false;
+
+static int gParallelCutoff = 1 << 14;
+
+void setParallelCutoff(int cutoff) {
+    gParallelCutoff = cutoff;
+}
+
+int parallelCutoff() {
+    return gParallelCutoff;
+}
+
+ThreadPool::ThreadPool(int workers) {
+    for (int i = 0; i < workers; ++i) {
+        workers_.emplace_back([this] { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool([] {
+        int hardware = static_cast<int>(std::thread::hardware_concurrency());
+        return hardware > 1 ? hardware - 1 : 0;  // the caller is the last thread
+    }());
+    return pool;
+}
+
+// Claims chunks one at a time until none are left. Called with the lock
+// held; releases it while the chunk body runs.
+void ThreadPool::drainChunks(std::unique_lock<std::mutex>& lock) {
+    while (nextChunk_ < chunks_) {
+        int chunk = nextChunk_++;
+        const std::function<void(int)>* body = body_;
+        lock.unlock();
+
+        tInsideJob = true;
+        (*body)(chunk);
+        tInsideJob = false;
+
+        lock.lock();
+        if (--pending_ == 0) {
+            done_.notify_all();
+        }
+    }
+}
+
+void ThreadPool::workerLoop() {
+    long long seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+        if (stopping_) return;
+        seen = generation_;
+        drainChunks(lock);
+    }
+}
+
+void ThreadPool::run(int chunks, const std::function<void(int)>& body) {
+    if (chunks <= 0) return;
+    if (chunks == 1 || workers_.empty() || tInsideJob) {
+        for (int chunk = 0; chunk < chunks; ++chunk) {
+            body(chunk);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> runLock(runMutex_);
+    std::unique_lock<std::mutex> lock(mutex_);
+    body_ = &body;
+    chunks_ = chunks;
+    nextChunk_ = 0;
+    pending_ = chunks;
+    ++generation_;
+    wake_.notify_all();
+
+    drainChunks(lock);
+    done_.wait(lock, [&] { return pending_ == 0; });
+    body_ = nullptr;
+    chunks_ = 0;
+}
+
+void poolParallelFor(int count, const std::function<void(int, int)>& body) {
+    ThreadPool& pool = ThreadPool::shared();
+    int chunks = pool.concurrency();
+    pool.run(chunks, [&](int chunk) {
+        body(chunkBegin(count, chunks, chunk), chunkBegin(count, chunks, chunk + 1));
+    });
+}
+
+// ==================== Demo ====================
+
+// Helper: prints an int array on one line
+void printInts(const char* label, const int* values, int count) {
+    std::cout << label;
+    for (int i = 0; i < count; ++i) {
+        std::cout << " " << values[i];
+    }
+    std::cout << '\n';
+}
+
+// Helper: milliseconds elapsed since 'start'
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Helper: times body() once, after refilling 'work' from 'original'
+template <typename Body>
+static double timeOnFreshCopy(const int* original, int* work, int n, Body&& body) {
+    std::copy(original, original + n, work);
+    auto start = std::chrono::steady_clock::now();
+    body();
+    return elapsedMs(start);
+}
+
+void parallelAlgorithms() {
+    std::cout << "\n=== Parallel Algorithms (Sort, Scan, Partition) ===" << '\n';
+
+    // ! DISCUSSION: Why contiguous arrays parallelize so well
+    //   A dynamic array or flat matrix is one block of memory, so we can
+    //   hand thread 0 the first quarter, thread 1 the second, and so on —
+    //   plain index math, no pointer chasing to find where a piece starts.
+    //   The hard part is combining the pieces; the prefix sum ("scan") is
+    //   the tool that makes almost every combine step parallel too.
+
+    // --- 1. Prefix sums ---
+    std::cout << "\n--- 1. Prefix Sums (Scan) ---" << '\n';
+
+    int values[] = {3, 1, 4, 1, 5, 9, 2, 6};
+    int scanned[8];
+    printInts("Input:         ", values, 8);
+    parallelInclusiveScan(values, scanned, 8);
+    printInts("Inclusive scan:", scanned, 8);
+    parallelExclusiveScan(values, scanned, 8);
+    printInts("Exclusive scan:", scanned, 8);
+
+    // ! DISCUSSION: Inclusive vs exclusive
+    //   Inclusive: out[i] includes in[i] — a running total.
+    //   Exclusive: out[i] stops just before in[i] — "how much came before
+    //   me", which is exactly a write POSITION. That's how the offsets
+    //   array in ragged_arrays.cpp was built, and how partition works below.
+
+    // --- 2. Partition and filter ---
+    std::cout << "\n--- 2. Stable Partition and Filter ---" << '\n';
+
+    int partitioned[8];
+    auto isEven = [](int x) { return x % 2 == 0; };
+    int evens = parallelPartition(values, partitioned, 8, isEven);
+    printInts("Evens first:   ", partitioned, 8);
+    std::cout << "Evens: " << evens << '\n';
+
+    int kept[8];
+    int keptCount = parallelFilter(values, kept, 8, [](int x) { return x > 3; });
+    printInts("Filter x > 3:  ", kept, keptCount);
+
+    // --- 3. Sorting ---
+    std::cout << "\n--- 3. Radix Sort and Merge Sort ---" << '\n';
+
+    int keys[] = {170, -45, 75, -90, 802, 24, 2, 66};
+    parallelRadixSort(keys, 8);
+    printInts("Radix sorted:  ", keys, 8);
+
+    // ! DISCUSSION: Radix sort never compares two elements
+    //   It buckets numbers by one byte at a time (lowest byte first),
+    //   keeping equal bytes in their previous order. After 4 passes a
+    //   32-bit int is fully sorted. Merge sort works for ANY type with a
+    //   comparison — here strings by length, equal lengths keep their order.
+
+    std::string words[] = {"pear", "fig", "apple", "kiwi", "plum", "date"};
+    parallelMergeSort(words, 6, [](const std::string& a, const std::string& b) {
+        return a.size() < b.size();
+    });
+    std::cout << "Merge sorted by length:";
+    for (const std::string& word : words) {
+        std::cout << " " << word;
+    }
+    std::cout << '\n';
+
+    // --- 4. Scaling ---
+    std::cout << "\n--- 4. Scaling vs std::sort ---" << '\n';
+
+    int n = 1 << 18;
+    int* original = new int[n];
+    int* work = new int[n];
+    int* expected = new int[n];
+    int* small = new int[n];  // 0..255, so running totals can't overflow
+    unsigned seed = 2024;
+    for (int i = 0; i < n; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        original[i] = static_cast<int>(seed >> 1) - (1 << 30);
+        small[i] = static_cast<int>(seed >> 24);
+    }
+
+    std::ostringstream report;
+    report.precision(2);
+    report << std::fixed;
+
+    double stdSortMs = timeOnFreshCopy(original, expected, n, [&] { std::sort(expected, expected + n); });
+    report << "Elements: " << n << ", hardware threads: " << std::thread::hardware_concurrency() << '\n';
+    report << "  std::sort                " << stdSortMs << " ms" << '\n';
+#if defined(__cpp_lib_execution)
+    double parSortMs = timeOnFreshCopy(original, work, n, [&] {
+        std::sort(std::execution::par, work, work + n);
+    });
+    report << "  std::sort(par)           " << parSortMs << " ms" << '\n';
+#else
+    report << "  std::sort(par)           not available in this standard library" << '\n';
+#endif
+
+    bool allSorted = true;
+    int threadCounts[] = {1, 2, 4};
+    for (int threads : threadCounts) {
+        ThreadPool pool(threads - 1);
+
+        double radixMs = timeOnFreshCopy(original, work, n, [&] { parallelRadixSort(work, n, pool); });
+        allSorted = allSorted && std::equal(work, work + n, expected);
+
+        double mergeMs = timeOnFreshCopy(original, work, n, [&] {
+            parallelMergeSort(work, n, std::less<>(), pool);
+        });
+        allSorted = allSorted && std::equal(work, work + n, expected);
+
+        double scanMs = timeOnFreshCopy(small, work, n, [&] { parallelInclusiveScan(work, work, n, pool); });
+
+        report << "  " << threads << " thread(s): radix " << radixMs << " ms, merge " << mergeMs
+               << " ms, scan " << scanMs << " ms" << '\n';
+    }
+
+    double stdScanMs = timeOnFreshCopy(small, work, n, [&] {
+        std::inclusive_scan(work, work + n, work);
+    });
+    report << "  std::inclusive_scan      " << stdScanMs << " ms" << '\n';
+    std::cout << report.str();
+    std::cout << (allSorted ? "All parallel sorts match std::sort" : "Parallel sort result DIFFERS") << '\n';
+
+    delete[] original;
+    delete[] work;
+    delete[] expected;
+    delete[] small;
+    original = work = expected = small = nullptr;
+
+    // ! DISCUSSION: Reading the numbers
+    //   Below parallelCutoff() elements every algorithm runs serially —
+    //   waking threads costs more than the work. Above it, speedup is
+    //   capped by memory bandwidth long before core count: radix sort and
+    //   scan read and write every element each pass.
+}
@@ -0,0 +1,314 @@
+#include "performance_counters.h"
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+// ==================== PerfCounters ====================
+
+static long long nowNanos() {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+long long scaledCount(unsigned long long value, unsigned long long enabled,
+                      unsigned long long running) {
+    if (running == 0) return -1;
+    double scale = static_cast<double>(enabled) / static_cast<double>(running);
+    return static_cast<long long>(static_cast<double>(value) * scale);
+}
+
+double PerfReport::ipc() const {
+    if (cycles <= 0 || instructions < 0) return -1.0;
+    return static_cast<double>(instructions) / static_cast<double>(cycles);
+}
+
+#if defined(__linux__)
+
+// Order matches the PerfReport fields: cycles, instructions, L1D, LLC, dTLB, branches
+static perf_event_attr eventAttr(int event) {
+    auto cacheMiss = [](unsigned long long cache) {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    };
+
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    switch (event) {
+        case 0: attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_CPU_CYCLES; break;
+        case 1: attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+        case 2: attr.type = PERF_TYPE_HW_CACHE; attr.config = cacheMiss(PERF_COUNT_HW_CACHE_L1D); break;
+        case 3: attr.type = PERF_TYPE_HW_CACHE; attr.config = cacheMiss(PERF_COUNT_HW_CACHE_LL); break;
+        case 4: attr.type = PERF_TYPE_HW_CACHE; attr.config = cacheMiss(PERF_COUNT_HW_CACHE_DTLB); break;
+        default: attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+    }
+    return attr;
+}
+
+PerfCounters::PerfCounters() {
+    int firstErrno = 0;
+    for (int e = 0; e < kEventCount; ++e) {
+        perf_event_attr attr = eventAttr(e);
+        // Instructions joins the cycles group (group_fd = leader); every
+        // other event stands alone so a PMU with few slots can still
+        // time-slice them. pid 0 = this thread, cpu -1 = any CPU.
+        int groupFd = (e == 1) ? fds_[0] : -1;
+        if (groupFd >= 0) attr.disabled = 0;  // members follow the leader
+        long fd = syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0);
+        if (fd >= 0) {
+            fds_[e] = static_cast<int>(fd);
+            ++openCount_;
+            if (groupFd >= 0) instructionsGrouped_ = true;
+        } else if (firstErrno == 0) {
+            firstErrno = errno;
+        }
+    }
+    if (openCount_ == 0) {
+        unavailableReason_ = std::string("perf_event_open: ") + std::strerror(firstErrno);
+    }
+}
+
+PerfCounters::~PerfCounters() {
+    for (int fd : fds_) {
+        if (fd >= 0) close(fd);
+    }
+}
+
+// Sends one ioctl to every counter. The cycles group is driven through
+// its leader with PERF_IOC_FLAG_GROUP, so both members switch together.
+void PerfCounters::controlAll(unsigned long request) {
+    for (int e = 0; e < kEventCount; ++e) {
+        if (fds_[e] < 0 || (e == 1 && instructionsGrouped_)) continue;
+        ioctl(fds_[e], request, e == 0 ? PERF_IOC_FLAG_GROUP : 0);
+    }
+}
+
+void PerfCounters::start() {
+    controlAll(PERF_EVENT_IOC_RESET);
+    controlAll(PERF_EVENT_IOC_ENABLE);
+    startNanos_ = nowNanos();
+}
+
+PerfReport PerfCounters::stop(const std::string& name) {
+    long long endNanos = nowNanos();
+    controlAll(PERF_EVENT_IOC_DISABLE);
+
+    long long values[kEventCount];
+    for (int e = 0; e < kEventCount; ++e) {
+        values[e] = -1;
+        if (fds_[e] < 0) continue;
+
+        // value, time enabled, time running. When more events are open than
+        // the PMU has slots, the kernel time-slices them; scale back up. An
+        // event that never got a slot in this region stays -1.
+        unsigned long long data[3] = {0, 0, 0};
+        if (read(fds_[e], data, sizeof(data)) == static_cast<ssize_t>(sizeof(data))) {
+            values[e] = scaledCount(data[0], data[1], data[2]);
+        }
+    }
+
+    PerfReport report;
+    report.name = name;
+    report.milliseconds = (endNanos - startNanos_) / 1e6;
+    report.countersAvailable = available();
+    report.cycles = values[0];
+    report.instructions = values[1];
+    report.l1dMisses = values[2];
+    report.llcMisses = values[3];
+    report.dtlbMisses = values[4];
+    report.branchMisses = values[5];
+    return report;
+}
+
+#else  // !__linux__: timing only
+
+PerfCounters::PerfCounters() {
+    unavailableReason_ = "hardware counters are only supported on Linux";
+}
+
+PerfCounters::~PerfCounters() = default;
+
+void PerfCounters::start() {
+    startNanos_ = nowNanos();
+}
+
+PerfReport PerfCounters::stop(const std::string& name) {
+    PerfReport report;
+    report.name = name;
+    report.milliseconds = (nowNanos() - startNanos_) / 1e6;
+    return report;
+}
+
+#endif
+
+// Helper: formats a counter, or "-" when it was not measured
+static std::string counterText(long long value) {
+    return value < 0 ? "-" : std::to_string(value);
+}
+
+void printPerfReport(const PerfReport& report) {
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(3);
+    line << "  " << std::left << std::setw(18) << report.name << std::right
+         << std::setw(10) << report.milliseconds << " ms";
+    if (report.countersAvailable) {
+        line << std::setprecision(2)
+             << "  cycles=" << counterText(report.cycles)
+             << " instr=" << counterText(report.instructions) << " IPC=";
+        if (report.ipc() < 0) {
+            line << "-";
+        } else {
+            line << report.ipc();
+        }
+        line << " L1D=" << counterText(report.l1dMisses)
+             << " LLC=" << counterText(report.llcMisses)
+             << " dTLB=" << counterText(report.dtlbMisses)
+             << " br=" << counterText(report.branchMisses);
+    }
+    std::cout << line.str() << '\n';
+}
+
+// ==================== Demo ====================
+
+void performanceCounters() {
+    std::cout << "\n=== Measuring Layouts with Hardware Counters ===" << '\n';
+
+    // ! DISCUSSION: "Cache-friendly" is a claim — let's measure it
+    //   twoDimensionalArrays() said the int** layout has poor cache
+    //   performance and the flat array is cache-friendly. The CPU keeps
+    //   counters for exactly these events:
+    //     cycles / instructions  -> IPC (instructions per cycle; higher is better)
+    //     L1D / LLC misses       -> data not found in the fastest / last cache
+    //     dTLB misses            -> address translations not cached
+    //     branch misses          -> mispredicted ifs and loop exits
+    //   Linux exposes them through perf_event_open. Inside many containers
+    //   the kernel refuses, so we fall back to timing alone.
+
+    // --- 1. Opening the counters ---
+    std::cout << "\n--- 1. Opening Counters ---" << '\n';
+
+    PerfCounters counters;
+    if (counters.available()) {
+        std::cout << "Hardware counters: available" << '\n';
+    } else {
+        std::cout << "Hardware counters: unavailable (" << counters.unavailableReason()
+                  << "), timing only" << '\n';
+    }
+
+    // --- 2. Spine vs flat traversal ---
+    std::cout << "\n--- 2. Spine vs Flat Traversal ---" << '\n';
+
+    int rows = 2048;
+    int cols = 512;
+    int passes = 4;
+
+    int** table = new int*[rows];
+    for (int r = 0; r < rows; ++r) {
+        table[r] = new int[cols];
+        for (int c = 0; c < cols; ++c) {
+            table[r][c] = (r * cols) + c + 1;
+        }
+    }
+
+    int* flat = new int[rows * cols];
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            flat[r * cols + c] = (r * cols) + c + 1;
+        }
+    }
+
+    long long spineSum = 0;
+    PerfReport spine = measureRegion(counters, "spine traversal", [&] {
+        for (int pass = 0; pass < passes; ++pass) {
+            for (int r = 0; r < rows; ++r) {
+                for (int c = 0; c < cols; ++c) {
+                    spineSum += table[r][c];
+                }
+            }
+        }
+    });
+
+    long long flatSum = 0;
+    PerfReport flatReport = measureRegion(counters, "flat traversal", [&] {
+        for (int pass = 0; pass < passes; ++pass) {
+            for (int r = 0; r < rows; ++r) {
+                for (int c = 0; c < cols; ++c) {
+                    flatSum += flat[r * cols + c];
+                }
+            }
+        }
+    });
+
+    printPerfReport(spine);
+    printPerfReport(flatReport);
+    std::cout << (spineSum == flatSum ? "Traversal sums match" : "Traversal sums DIFFER") << '\n';
+
+    for (int r = 0; r < rows; ++r) {
+        delete[] table[r];
+    }
+    delete[] table;
+    table = nullptr;
+    delete[] flat;
+    flat = nullptr;
+
+    // ! DISCUSSION: Reading the traversal numbers
+    //   Freshly allocated rows often land next to each other on the heap,
+    //   so the spine can look almost as good as flat here. The difference
+    //   grows when rows are allocated at different times (fragmented heap)
+    //   or are short, because every row start is a new, unpredictable address.
+
+    // --- 3. Doubling resize ---
+    std::cout << "\n--- 3. Doubling Resize ---" << '\n';
+
+    int target = 1 << 20;
+    int finalCapacity = 0;
+    int resizes = 0;
+    PerfReport resize = measureRegion(counters, "doubling resize", [&] {
+        int capacity = 4;
+        int count = 0;
+        int* arr = new int[capacity];
+        for (int value = 0; value < target; ++value) {
+            if (count == capacity) {
+                int newCapacity = capacity * 2;
+                int* newArr = new int[newCapacity];
+                for (int i = 0; i < count; ++i) {
+                    newArr[i] = arr[i];
+                }
+                delete[] arr;
+                arr = newArr;
+                capacity = newCapacity;
+                ++resizes;
+            }
+            arr[count] = value;
+            count++;
+        }
+        finalCapacity = capacity;
+        delete[] arr;
+    });
+
+    printPerfReport(resize);
+    std::cout << "Appended " << target << " ints with " << resizes
+              << " resizes (final capacity=" << finalCapacity << ")" << '\n';
+
+    // ! DISCUSSION: Where does resize time go?
+    //   Each resize copies every element so far, but the copies add up to
+    //   less than 2 * count in total — the same O(1)-on-average argument
+    //   from dynamicArrays(). The counters show those copies as a burst of
+    //   cache and TLB misses each time a fresh, bigger block is touched.
+}
@@ -0,0 +1,196 @@
+#include "ragged_arrays.h"
+
+#include <chrono>
+#include <iostream>
+
+// Helper: prints every row of a ragged array, one line per row
+void printRagged(const RaggedArray<int>& ragged) {
+    for (int r = 0; r < ragged.rowCount(); ++r) {
+        std::cout << "  Row " << r << ":";
+        for (int value : ragged.row(r)) {
+            std::cout << " " << value;
+        }
+        std::cout << '\n';
+    }
+}
+
+// Helper: milliseconds elapsed since 'start'
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Skewed row lengths: most rows are short (1..8), every 100th row is long.
+static int skewedRowLength(int r) {
+    return (r % 100 == 0) ? 1000 : (r % 8) + 1;
+}
+
+void raggedArrays() {
+    std::cout << "\n=== Ragged Arrays (Values Buffer + Offsets) ===" << '\n';
+
+    // ! DISCUSSION: Where we left off
+    //   twoDimensionalArrays() said the int** "spine + rows" layout is
+    //   useful when rows have DIFFERENT lengths (a jagged array). It still
+    //   costs 1 + rows allocations, and every row access follows two
+    //   pointers: table -> table[r] -> value.
+    //   We can keep jagged rows AND get the flat array's single block by
+    //   storing a second, small array that remembers where each row starts.
+
+    // --- 1. From the int** spine to values + offsets ---
+    std::cout << "\n--- 1. Converting a Jagged int** Table ---" << '\n';
+
+    int rowCount = 3;
+    int rowLengths[] = {1, 4, 2};
+
+    int** table = new int*[rowCount];
+    int next = 1;
+    for (int r = 0; r < rowCount; ++r) {
+        table[r] = new int[rowLengths[r]];
+        for (int c = 0; c < rowLengths[r]; ++c) {
+            table[r][c] = next++;
+        }
+    }
+
+    RaggedArray<int> ragged(table, rowLengths, rowCount);
+
+    for (int r = 0; r < rowCount; ++r) {
+        delete[] table[r];
+    }
+    delete[] table;
+    table = nullptr;
+
+    // ! DISCUSSION: The offsets array is a running total ("prefix sum")
+    //   offsets[0] = 0, and each next entry adds one row's length:
+    //     lengths = {1, 4, 2}  ->  offsets = {0, 1, 5, 7}
+    //   Row r is values[offsets[r]] .. values[offsets[r + 1] - 1], and its
+    //   length is offsets[r + 1] - offsets[r]. Finding a row is O(1).
+
+    std::cout << "Values:";
+    for (int r = 0; r < ragged.rowCount(); ++r) {
+        for (int value : ragged.row(r)) {
+            std::cout << " " << value;
+        }
+    }
+    std::cout << '\n';
+
+    std::cout << "Offsets: 0";
+    int offset = 0;
+    for (int r = 0; r < ragged.rowCount(); ++r) {
+        offset += ragged.rowLength(r);
+        std::cout << " " << offset;
+    }
+    std::cout << '\n';
+
+    std::cout << "Ragged array:" << '\n';
+    printRagged(ragged);
+
+    // --- 2. Building row by row ---
+    std::cout << "\n--- 2. Building Row by Row (appendRow) ---" << '\n';
+
+    // ! DISCUSSION: appendRow is push_back for whole rows
+    //   The values buffer uses the count/capacity doubling from
+    //   dynamicArrays(), so adding rows is O(1) on average per value.
+    //   The offsets buffer doubles the same way, one entry per row.
+
+    RaggedArray<int> built;
+    int shortRow[] = {7};
+    int longRow[] = {8, 9, 10, 11, 12};
+    built.appendRow(shortRow, 1);
+    std::cout << "After 1 row:  (values=" << built.valueCount()
+              << ", capacity=" << built.valueCapacity() << ")" << '\n';
+    built.appendRow(longRow, 5);
+    std::cout << "After 2 rows: (values=" << built.valueCount()
+              << ", capacity=" << built.valueCapacity() << ")" << '\n';
+    printRagged(built);
+
+    // --- 3. Spine vs offsets on skewed rows ---
+    std::cout << "\n--- 3. Spine vs Offsets (Skewed Row Lengths) ---" << '\n';
+
+    // ! DISCUSSION: What we measure
+    //   Real jagged data is rarely even: most rows are short and a few are
+    //   huge. Short rows are where the spine hurts most — every tiny row
+    //   is its own heap block with its own bookkeeping overhead.
+    //   Timings vary by machine; allocation counts and bytes do not.
+
+    int benchRows = 20000;
+    int passes = 20;
+    int* benchLengths = new int[benchRows];
+    int benchTotal = 0;
+    for (int r = 0; r < benchRows; ++r) {
+        benchLengths[r] = skewedRowLength(r);
+        benchTotal += benchLengths[r];
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    int** spine = new int*[benchRows];
+    for (int r = 0; r < benchRows; ++r) {
+        spine[r] = new int[benchLengths[r]];
+        for (int c = 0; c < benchLengths[r]; ++c) {
+            spine[r][c] = r + c;
+        }
+    }
+    double spineBuildMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    RaggedArray<int> appended;
+    for (int r = 0; r < benchRows; ++r) {
+        appended.appendRow(spine[r], benchLengths[r]);
+    }
+    double appendBuildMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    RaggedArray<int> bulk(spine, benchLengths, benchRows);
+    double bulkBuildMs = elapsedMs(start);
+
+    long long spineSum = 0;
+    start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        for (int r = 0; r < benchRows; ++r) {
+            for (int c = 0; c < benchLengths[r]; ++c) {
+                spineSum += spine[r][c];
+            }
+        }
+    }
+    double spineIterMs = elapsedMs(start);
+
+    long long raggedSum = 0;
+    start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        for (int r = 0; r < bulk.rowCount(); ++r) {
+            for (int value : bulk.row(r)) {
+                raggedSum += value;
+            }
+        }
+    }
+    double raggedIterMs = elapsedMs(start);
+
+    std::size_t spineBytes = benchRows * sizeof(int*) + benchTotal * sizeof(int);
+
+    std::cout << "Rows: " << benchRows << ", values: " << benchTotal << '\n';
+    std::cout << "Spine + rows:    " << benchRows + 1 << " allocations, "
+              << spineBytes << " bytes" << '\n';
+    std::cout << "Ragged (append): 2 buffers, " << appended.bytesAllocated() << " bytes" << '\n';
+    std::cout << "Ragged (bulk):   2 buffers, " << bulk.bytesAllocated() << " bytes" << '\n';
+    std::cout << "Build ms:   spine " << spineBuildMs << ", append " << appendBuildMs
+              << ", bulk " << bulkBuildMs << '\n';
+    std::cout << "Iterate ms: spine " << spineIterMs << ", ragged " << raggedIterMs
+              << " (" << passes << " passes)" << '\n';
+    std::cout << (spineSum == raggedSum ? "Checksums match" : "Checksums DIFFER") << '\n';
+
+    // ! DISCUSSION: Reading the numbers
+    //   The spine byte count above is a floor: every new[] also pays the
+    //   allocator's per-block header (often 16 bytes) and rounding, which
+    //   is paid 20001 times here versus twice for the ragged array.
+    //   The appended version holds up to 2x spare capacity from doubling;
+    //   the bulk version knew every size up front and holds none.
+
+    for (int r = 0; r < benchRows; ++r) {
+        delete[] spine[r];
+    }
+    delete[] spine;
+    spine = nullptr;
+    delete[] benchLengths;
+    benchLengths = nullptr;
+
+    std::cout << "Spine freed (" << benchRows + 1 << " delete[] calls); ragged arrays free themselves" << '\n';
+}
@@ -0,0 +1,363 @@
+#include "shrinking_arrays.h"
+
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// ==================== Registry ====================
+
+static std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::vector<ShrinkableArray*>& registry() {
+    static std::vector<ShrinkableArray*> arrays;
+    return arrays;
+}
+
+std::size_t trimAllArrays() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    std::size_t released = 0;
+    for (ShrinkableArray* arr : registry()) {
+        released += arr->trim();
+    }
+    return released;
+}
+
+int registeredArrayCount() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    return static_cast<int>(registry().size());
+}
+
+// ==================== Pages ====================
+
+static std::size_t pageSize() {
+#if defined(__linux__)
+    static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+#else
+    return 4096;
+#endif
+}
+
+static std::size_t roundUpToPage(std::size_t bytes) {
+    std::size_t page = pageSize();
+    return (bytes + page - 1) / page * page;
+}
+
+long long currentRssBytes() {
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    long long totalPages = 0;
+    long long residentPages = 0;
+    if (statm >> totalPages >> residentPages) {
+        return residentPages * static_cast<long long>(pageSize());
+    }
+#endif
+    return -1;
+}
+
+// ==================== ShrinkableArray ====================
+
+ShrinkableArray::ShrinkableArray(ShrinkPolicy policy) : policy_(policy) {
+    assert(policy_.lowWaterRatio >= 0.0 && policy_.lowWaterRatio < 0.5);
+    assert(policy_.minCapacity > 0);
+    reallocate(policy_.minCapacity);
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+    registry().push_back(this);
+}
+
+ShrinkableArray::~ShrinkableArray() {
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        std::vector<ShrinkableArray*>& arrays = registry();
+        for (std::size_t i = 0; i < arrays.size(); ++i) {
+            if (arrays[i] == this) {
+                arrays[i] = arrays.back();
+                arrays.pop_back();
+                break;
+            }
+        }
+    }
+
+#if defined(__linux__)
+    if (mapped_) {
+        munmap(data_, roundUpToPage(static_cast<std::size_t>(reserved_) * sizeof(int)));
+        data_ = nullptr;
+        return;
+    }
+#endif
+    delete[] data_;
+    data_ = nullptr;
+}
+
+// Allocate, copy, delete old — with big buffers mmap'd so they start on a
+// page boundary and can later be trimmed page by page.
+void ShrinkableArray::reallocate(int newCapacity) {
+    std::size_t bytes = static_cast<std::size_t>(newCapacity) * sizeof(int);
+    int* newData = nullptr;
+    bool newMapped = false;
+    int newReserved = newCapacity;
+
+#if defined(__linux__)
+    if (policy_.madviseMinBytes > 0 && bytes >= policy_.madviseMinBytes) {
+        std::size_t mappedBytes = roundUpToPage(bytes);
+        void* block = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (block != MAP_FAILED) {
+            newData = static_cast<int*>(block);
+            newMapped = true;
+            newReserved = static_cast<int>(mappedBytes / sizeof(int));
+        }
+    }
+#endif
+    if (newData == nullptr) {
+        newData = new int[newCapacity];
+    }
+
+    for (int i = 0; i < count_; ++i) {
+        newData[i] = data_[i];
+    }
+
+#if defined(__linux__)
+    if (mapped_) {
+        munmap(data_, roundUpToPage(static_cast<std::size_t>(reserved_) * sizeof(int)));
+    } else {
+        delete[] data_;
+    }
+#else
+    delete[] data_;
+#endif
+
+    data_ = newData;
+    capacity_ = newCapacity;
+    reserved_ = newReserved;
+    mapped_ = newMapped;
+}
+
+void ShrinkableArray::shrinkTo(int newCapacity) {
+    if (newCapacity >= capacity_) return;
+
+#if defined(__linux__)
+    if (mapped_) {
+        // ! DISCUSSION: Shrinking without copying
+        //   The elements we keep stay exactly where they are. We only tell
+        //   the kernel the whole pages past the new capacity are unused;
+        //   it drops them from RSS but keeps the address range reserved,
+        //   so growing back later needs no copy either.
+        std::size_t keepBytes = roundUpToPage(static_cast<std::size_t>(newCapacity) * sizeof(int));
+        std::size_t usedBytes = roundUpToPage(static_cast<std::size_t>(capacity_) * sizeof(int));
+        if (usedBytes > keepBytes) {
+            char* tail = reinterpret_cast<char*>(data_) + keepBytes;
+            int advice = MADV_DONTNEED;
+#if defined(MADV_FREE)
+            if (policy_.useMadvFree) advice = MADV_FREE;
+#endif
+            madvise(tail, usedBytes - keepBytes, advice);
+        }
+        capacity_ = newCapacity;
+        return;
+    }
+#endif
+    reallocate(newCapacity);
+}
+
+// ! DISCUSSION: Why shrink at 1/4 full and not 1/2?
+//   Grow happens when the array is FULL and doubles it; if we halved as
+//   soon as it dropped below half, one push/pop pair at the boundary would
+//   allocate and copy every time. Halving at 1/4 leaves the array half
+//   full, so it takes many pushes or pops before anything happens again.
+void ShrinkableArray::maybeShrink() {
+    if (policy_.lowWaterRatio <= 0.0) return;
+
+    int target = capacity_;
+    while (target / 2 >= policy_.minCapacity && count_ < target * policy_.lowWaterRatio) {
+        target /= 2;
+    }
+    shrinkTo(target);
+}
+
+void ShrinkableArray::push(int value) {
+    if (count_ == capacity_) {
+        int newCapacity = capacity_ * 2;
+        if (newCapacity <= reserved_) {
+            capacity_ = newCapacity;  // pages released earlier fault back in on use
+        } else {
+            reallocate(newCapacity);
+        }
+    }
+    data_[count_] = value;
+    count_++;
+}
+
+void ShrinkableArray::pop() {
+    assert(count_ > 0);
+    count_--;
+    maybeShrink();
+}
+
+void ShrinkableArray::clear() {
+    count_ = 0;
+    maybeShrink();
+}
+
+std::size_t ShrinkableArray::trim() {
+    std::size_t before = committedBytes();
+    int target = count_ > policy_.minCapacity ? count_ : policy_.minCapacity;
+    shrinkTo(target);
+    return before - committedBytes();
+}
+
+std::size_t ShrinkableArray::committedBytes() const {
+    std::size_t bytes = static_cast<std::size_t>(capacity_) * sizeof(int);
+    return mapped_ ? roundUpToPage(bytes) : bytes;
+}
+
+// ==================== Demo ====================
+
+// Helper: prints count and capacity of a shrinkable array
+void printShrinkable(const char* label, const ShrinkableArray& arr) {
+    std::cout << label << "  (count=" << arr.count() << ", capacity=" << arr.capacity() << ")" << '\n';
+}
+
+// Helper: RSS growth since 'baseline' in whole KiB, or "?" when /proc is unavailable
+static std::string rssGrowth(long long now, long long baseline) {
+    if (now < 0 || baseline < 0) return "?";
+    long long kib = (now - baseline) / 1024;
+    std::string sign = kib < 0 ? "" : "+";
+    return sign + std::to_string(kib) + " KiB";
+}
+
+// One bursty run: every array bursts to 'peak' elements, then drains to
+// 'idle' and stays there. Records RSS (relative to the start) after each phase.
+static void burstyRun(const char* name, ShrinkPolicy policy, int arrays, int peak, int idle, int bursts) {
+    long long baseline = currentRssBytes();
+    ShrinkableArray** live = new ShrinkableArray*[arrays];
+    for (int a = 0; a < arrays; ++a) {
+        live[a] = new ShrinkableArray(policy);
+    }
+
+    std::cout << "  " << name << ":";
+    for (int burst = 1; burst <= bursts; ++burst) {
+        for (int a = 0; a < arrays; ++a) {
+            while (live[a]->count() < peak) live[a]->push(live[a]->count());
+        }
+        long long atPeak = currentRssBytes();
+        for (int a = 0; a < arrays; ++a) {
+            while (live[a]->count() > idle) live[a]->pop();
+        }
+        long long atIdle = currentRssBytes();
+        std::cout << "  burst " << burst << " " << rssGrowth(atPeak, baseline)
+                  << ", idle " << rssGrowth(atIdle, baseline);
+    }
+
+    std::size_t committed = 0;
+    for (int a = 0; a < arrays; ++a) {
+        committed += live[a]->committedBytes();
+    }
+    std::cout << "  (committed " << committed / 1024 << " KiB)" << '\n';
+
+    for (int a = 0; a < arrays; ++a) {
+        delete live[a];
+    }
+    delete[] live;
+    live = nullptr;
+}
+
+void shrinkingArrays() {
+    std::cout << "\n=== Shrinking Arrays (Giving Memory Back) ===" << '\n';
+
+    // ! DISCUSSION: dynamicArrays() only ever grows
+    //   After a burst of 1,000,000 pushes, popping back down to 10 elements
+    //   still holds the full 1,000,000-slot block. One array doesn't matter;
+    //   thousands of long-lived arrays in one program do.
+
+    // --- 1. Shrinking with hysteresis ---
+    std::cout << "\n--- 1. Shrink at 1/4 Full (Hysteresis) ---" << '\n';
+
+    ShrinkableArray arr;
+    for (int i = 1; i <= 16; ++i) {
+        arr.push(i * 10);
+    }
+    printShrinkable("After 16 pushes:", arr);
+
+    while (arr.count() > 4) arr.pop();
+    printShrinkable("Popped to 4:    ", arr);
+    arr.pop();
+    printShrinkable("Popped to 3:    ", arr);
+    arr.push(40);
+    arr.push(50);
+    printShrinkable("Pushed to 5:    ", arr);
+
+    // ! DISCUSSION: What just happened
+    //   At 4 of 16 we are exactly at 1/4 — no shrink. One more pop drops
+    //   below 1/4, so capacity halves to 8 and the array is 3/8 full.
+    //   Pushing back to 5 fits in 8 — nothing is reallocated.
+
+    // --- 2. Large buffers: madvise instead of copy ---
+    std::cout << "\n--- 2. Large Buffers (madvise) ---" << '\n';
+
+    ShrinkableArray big;
+    for (int i = 0; i < (1 << 20); ++i) {
+        big.push(i);
+    }
+    std::size_t bigBefore = big.committedBytes();
+    std::cout << "Big array: count=" << big.count() << ", "
+              << (big.isMapped() ? "page-aligned mmap buffer" : "heap buffer") << '\n';
+    while (big.count() > 1000) big.pop();
+    std::cout << "Drained to 1000: committed " << bigBefore / 1024 << " KiB -> "
+              << big.committedBytes() / 1024 << " KiB" << '\n';
+    std::cout << "First element still " << big[0] << ", last kept " << big[big.count() - 1] << '\n';
+
+    // --- 3. Trimming everything under memory pressure ---
+    std::cout << "\n--- 3. Process-Wide Trim ---" << '\n';
+
+    // ! DISCUSSION: A hook for "memory is tight"
+    //   Every ShrinkableArray registers itself when constructed and leaves
+    //   the registry when destroyed. A memory-pressure handler can call
+    //   trimAllArrays() to squeeze every array down to its count.
+
+    ShrinkableArray spare;
+    for (int i = 0; i < 100; ++i) spare.push(i);
+    std::cout << "Registered arrays: " << registeredArrayCount() << '\n';
+    std::size_t released = trimAllArrays();
+    std::cout << "trimAllArrays() released " << released << " bytes" << '\n';
+    printShrinkable("Spare after trim:", spare);
+
+    // --- 4. RSS over a bursty workload ---
+    std::cout << "\n--- 4. RSS Over a Bursty Workload ---" << '\n';
+
+    // ! DISCUSSION: Reading the numbers
+    //   RSS (resident set size) is the memory the OS has actually handed
+    //   this process. Grow-only keeps every burst's peak forever. Copy-
+    //   shrinking frees the big blocks, but the heap may keep them cached
+    //   instead of returning them. madvise hands pages straight back.
+
+    int arrays = 16;
+    int peak = 1 << 18;  // 1 MiB of ints per array at the peak
+    int idle = 1024;
+    int bursts = 2;
+
+    ShrinkPolicy growOnly;
+    growOnly.lowWaterRatio = 0.0;
+    ShrinkPolicy copyShrink;
+    copyShrink.madviseMinBytes = 0;
+    ShrinkPolicy madviseShrink;
+
+    if (currentRssBytes() < 0) {
+        std::cout << "RSS unavailable on this platform; showing committed bytes only" << '\n';
+    }
+    burstyRun("grow-only     ", growOnly, arrays, peak, idle, bursts);
+    burstyRun("shrink (copy) ", copyShrink, arrays, peak, idle, bursts);
+    burstyRun("shrink+madvise", madviseShrink, arrays, peak, idle, bursts);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <iostream>
+#include "compressed_arrays.h"
+
+// Helper: capture stdout from compressedArrays()
+static std::string captureOutput() {
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    compressedArrays();
+    std::cout.rdbuf(oldCout);
+    return buffer.str();
+}
+
+// ==================== 1. Encoding Blocks ====================
+
+TEST(CompressedArraysTest, BlockEncodingsChosen) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("Block 0: delta, 0 bits per value, 128 values") != std::string::npos)
+        << "10, 20, 30, ... has a constant gap and should need 0 bits";
+    EXPECT_TRUE(output.find("Block 1: frame of reference, 3 bits per value, 128 values") != std::string::npos)
+        << "Counters 0..4 should be stored in 3 bits each";
+    EXPECT_TRUE(output.find("Block 2: raw tail, 32 bits per value, 2 values") != std::string::npos)
+        << "The partial last block should stay uncompressed";
+}
+
+// ==================== 2. Random Access ====================
+
+TEST(CompressedArraysTest, RandomAccess) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("get(0)=10, get(127)=1280, get(131)=3, get(257)=8") != std::string::npos);
+}
+
+// ==================== 3. Block Decode ====================
+
+TEST(CompressedArraysTest, BlockDecoded) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("Block 0 starts: 10 20 30 40 50") != std::string::npos);
+}
+
+// ==================== 4. Compressed vs Plain ====================
+
+TEST(CompressedArraysTest, BenchmarkValuesMatch) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("Decoded values DIFFER") == std::string::npos);
+    EXPECT_TRUE(output.find("Monotonic IDs: 1048576 -> ") != std::string::npos);
+}
+
+// ==================== CompressedIntArray ====================
+
+TEST(CompressedIntArrayTest, DecodeMatchesGetForEveryWidth) {
+    CompressedIntArray arr;
+    std::uint32_t seed = 7;
+    for (int bits = 0; bits <= 32; ++bits) {
+        std::uint32_t mask = bits == 32 ? 0xFFFFFFFFu : (1u << bits) - 1u;
+        for (int i = 0; i < CompressedIntArray::kBlockSize; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            arr.append(seed & mask);
+        }
+    }
+    std::uint32_t running = 0;
+    for (int i = 0; i < CompressedIntArray::kBlockSize + 5; ++i) {
+        running += static_cast<std::uint32_t>(i % 9);
+        arr.append(running);
+    }
+
+    std::uint32_t block[CompressedIntArray::kBlockSize];
+    for (int b = 0; b < arr.blockCount(); ++b) {
+        arr.decodeBlock(b, block);
+        for (int i = 0; i < arr.blockLength(b); ++i) {
+            ASSERT_EQ(block[i], arr.get(b * CompressedIntArray::kBlockSize + i))
+                << "block " << b << ", index " << i;
+        }
+    }
+    EXPECT_TRUE(arr.blockIsDelta(33)) << "A non-decreasing block should use delta";
+}
+
+TEST(CompressedIntArrayTest, RoundTripsAppendedValues) {
+    CompressedIntArray arr;
+    for (int i = 0; i < 1000; ++i) {
+        arr.append(static_cast<std::uint32_t>((i * 37) % 1001));
+    }
+    ASSERT_EQ(arr.size(), 1000);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(arr.get(i), static_cast<std::uint32_t>((i * 37) % 1001));
+    }
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <iostream>
+#include "expression_templates.h"
+
+// Helper: capture stdout from expressionTemplates()
+static std::string captureOutput() {
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    expressionTemplates();
+    std::cout.rdbuf(oldCout);
+    return buffer.str();
+}
+
+// ==================== 1. Eager Evaluation ====================
+
+TEST(ExpressionTemplatesTest, EagerResult) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("Eager result (3 temporary arrays):  [11, 23, 35, 47, 59]") != std::string::npos)
+        << "Eager A * 2 + B - D should produce [11, 23, 35, 47, 59]";
+}
+
+// ==================== 2. Lazy Expression ====================
+
+TEST(ExpressionTemplatesTest, LazyMatchesEager) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("C = A * 2 + B - D:  [11, 23, 35, 47, 59]") != std::string::npos)
+        << "The fused expression should compute the same values";
+    EXPECT_TRUE(output.find("Matches eager result") != std::string::npos);
+}
+
+// ==================== 3. Flat Matrix Expressions ====================
+
+TEST(ExpressionTemplatesTest, FlatMatrixInPlace) {
+    std::string output = captureOutput();
+    auto pos = output.find("M = M * 10 - M:");
+    ASSERT_TRUE(pos != std::string::npos);
+    std::string section = output.substr(pos);
+    EXPECT_TRUE(section.find("Row 0: 9 18 27 36") != std::string::npos);
+    EXPECT_TRUE(section.find("Row 2: 81 90 99 108") != std::string::npos);
+}
+
+// ==================== 4. Eager vs Fused vs Parallel ====================
+
+TEST(ExpressionTemplatesTest, BenchmarkResultsMatch) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("All three results match") != std::string::npos)
+        << "Eager, fused and parallel evaluation should agree";
+}
+
+// ==================== Evaluation hook ====================
+
+static int gBackendCalls = 0;
+
+static void countingParallelFor(int count, const std::function<void(int, int)>& body) {
+    ++gBackendCalls;
+    body(0, count / 2);
+    body(count / 2, count);
+}
+
+TEST(ParallelEvalTest, BackendUsedAtCutoff) {
+    ParallelFor savedBackend = parallelEvalBackend();
+    int savedCutoff = parallelEvalCutoff();
+    setParallelEval(countingParallelFor, 4);
+    gBackendCalls = 0;
+
+    int small[] = {1, 2, 3};
+    int large[] = {1, 2, 3, 4, 5};
+    ArrayView<int> S(small, 3);
+    ArrayView<int> L(large, 5);
+    S = 3 * S + 1;
+    EXPECT_EQ(gBackendCalls, 0) << "Below the cutoff should stay serial";
+    L = L * L - 1;
+    EXPECT_EQ(gBackendCalls, 1) << "At or above the cutoff should use the backend";
+    EXPECT_EQ(small[2], 10);
+    EXPECT_EQ(large[4], 24);
+
+    setParallelEval(savedBackend, savedCutoff);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include "flat_hash_maps.h"
+
+// Helper: capture stdout from flatHashMaps()
+static std::string captureOutput() {
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    flatHashMaps();
+    std::cout.rdbuf(oldCout);
+    return buffer.str();
+}
+
+// ==================== 1. Insert and Find ====================
+
+TEST(FlatHashMapsTest, InsertAndFind) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("Size: 3, capacity: 16") != std::string::npos);
+    EXPECT_TRUE(output.find("find(20): 200") != std::string::npos);
+    EXPECT_TRUE(output.find("find(40): not found") != std::string::npos);
+    EXPECT_TRUE(output.find("insert(20, 250) updated: find(20)=250") != std::string::npos)
+        << "Inserting an existing key should update its value";
+}
+
+// ==================== 2. Growing ====================
+
+TEST(FlatHashMapsTest, DoublesAtSevenEighths) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("After 14 inserts: size=14, capacity=16") != std::string::npos);
+    EXPECT_TRUE(output.find("After 15 inserts: size=15, capacity=32") != std::string::npos)
+        << "The 15th entry would pass 7/8 of 16, so capacity should double";
+    EXPECT_TRUE(output.find("find(12) after growing: 144") != std::string::npos);
+}
+
+// ==================== 3. Erase ====================
+
+TEST(FlatHashMapsTest, Erase) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("erase(10): erased") != std::string::npos);
+    EXPECT_TRUE(output.find("erase(10) again: missing") != std::string::npos);
+    EXPECT_TRUE(output.find("Size: 2, find(30): 300") != std::string::npos);
+}
+
+// ==================== 4. Benchmarks ====================
+
+TEST(FlatHashMapsTest, BenchmarkMapsAgree) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("n=10^5") != std::string::npos);
+    EXPECT_TRUE(output.find("Both maps agree on every operation") != std::string::npos);
+}
+
+// ==================== FlatHashMap<K, V> ====================
+
+TEST(FlatHashMapTest, MatchesUnorderedMapUnderChurn) {
+    FlatHashMap<int, int> flat;
+    std::unordered_map<int, int> reference;
+    unsigned seed = 99;
+    for (int op = 0; op < 200000; ++op) {
+        seed = seed * 1664525u + 1013904223u;
+        int key = static_cast<int>(seed >> 20);  // 4096 distinct keys: lots of reuse
+        if ((seed & 3) == 0) {
+            EXPECT_EQ(flat.erase(key), reference.erase(key) == 1);
+        } else {
+            EXPECT_EQ(flat.insert(key, op), reference.insert_or_assign(key, op).second);
+        }
+    }
+    ASSERT_EQ(flat.size(), static_cast<int>(reference.size()));
+    for (const auto& [key, value] : reference) {
+        ASSERT_NE(flat.find(key), nullptr);
+        EXPECT_EQ(*flat.find(key), value);
+    }
+    EXPECT_LE(flat.loadFactor(), 7.0 / 8.0);
+}
+
+TEST(FlatHashMapTest, StringKeys) {
+    FlatHashMap<std::string, int> counts;
+    for (const char* word : {"apple", "fig", "apple", "kiwi", "fig", "apple"}) {
+        int* count = counts.find(word);
+        if (count != nullptr) {
+            ++*count;
+        } else {
+            counts.insert(word, 1);
+        }
+    }
+    EXPECT_EQ(counts.size(), 3);
+    EXPECT_EQ(*counts.find("apple"), 3);
+    EXPECT_EQ(*counts.find("fig"), 2);
+    EXPECT_FALSE(counts.contains("pear"));
+}
+
+TEST(FlatHashMapTest, InsertOwnValueAcrossGrowth) {
+    FlatHashMap<int, std::string> map;
+    for (int i = 1; i <= 14; ++i) {
+        map.insert(i, "value " + std::to_string(i));
+    }
+    ASSERT_EQ(map.capacity(), 16);
+    map.insert(100, *map.find(3));  // the 15th entry doubles the table
+    EXPECT_EQ(map.capacity(), 32);
+    ASSERT_NE(map.find(100), nullptr);
+    EXPECT_EQ(*map.find(100), "value 3");
+    EXPECT_EQ(*map.find(3), "value 3");
+}
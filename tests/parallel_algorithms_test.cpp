@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <iostream>
+#include <memory>
+#include "parallel_algorithms.h"
+
+// Helper: capture stdout from parallelAlgorithms()
+static std::string captureOutput() {
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    parallelAlgorithms();
+    std::cout.rdbuf(oldCout);
+    return buffer.str();
+}
+
+// ==================== 1. Prefix Sums ====================
+
+TEST(ParallelAlgorithmsTest, Scans) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("Inclusive scan: 3 4 8 9 14 23 25 31") != std::string::npos);
+    EXPECT_TRUE(output.find("Exclusive scan: 0 3 4 8 9 14 23 25") != std::string::npos);
+}
+
+// ==================== 2. Stable Partition and Filter ====================
+
+TEST(ParallelAlgorithmsTest, PartitionAndFilter) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("Evens first:    4 2 6 3 1 1 5 9") != std::string::npos)
+        << "Partition should keep both groups in their original order";
+    EXPECT_TRUE(output.find("Filter x > 3:   4 5 9 6") != std::string::npos);
+}
+
+// ==================== 3. Radix Sort and Merge Sort ====================
+
+TEST(ParallelAlgorithmsTest, Sorts) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("Radix sorted:   -90 -45 2 24 66 75 170 802") != std::string::npos);
+    EXPECT_TRUE(output.find("Merge sorted by length: fig pear kiwi plum date apple") != std::string::npos)
+        << "Merge sort should be stable";
+}
+
+// ==================== 4. Scaling ====================
+
+TEST(ParallelAlgorithmsTest, ScalingResultsMatch) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("All parallel sorts match std::sort") != std::string::npos);
+}
+
+// ==================== Above the cutoff ====================
+
+TEST(ParallelPrimitivesTest, LargeInputsMatchSerial) {
+    ThreadPool pool(3);
+    int n = 100003;
+    std::vector<int> data(n);
+    unsigned seed = 1;
+    for (int& x : data) {
+        seed = seed * 1664525u + 1013904223u;
+        x = static_cast<int>(seed);
+    }
+
+    std::vector<int> expected = data;
+    std::sort(expected.begin(), expected.end());
+    std::vector<int> radix = data;
+    parallelRadixSort(radix.data(), n, pool);
+    EXPECT_EQ(radix, expected);
+    std::vector<int> merged = data;
+    parallelMergeSort(merged.data(), n, std::less<>(), pool);
+    EXPECT_EQ(merged, expected);
+
+    std::vector<long long> wide(n, 2);
+    parallelInclusiveScan(wide.data(), wide.data(), n, pool);
+    EXPECT_EQ(wide[n - 1], 2LL * n);
+
+    std::vector<int> out(n);
+    int passed = parallelPartition(data.data(), out.data(), n, [](int x) { return x < 0; }, true, pool);
+    std::vector<int> expectedOut;
+    std::copy_if(data.begin(), data.end(), std::back_inserter(expectedOut), [](int x) { return x < 0; });
+    EXPECT_EQ(passed, static_cast<int>(expectedOut.size()));
+    std::copy_if(data.begin(), data.end(), std::back_inserter(expectedOut), [](int x) { return x >= 0; });
+    EXPECT_EQ(out, expectedOut);
+}
+
+// Move-only and not default-constructible: the merge sort must move
+struct Ticket {
+    Ticket(int key, int order) : key(std::make_unique<int>(key)), order(order) {}
+    std::unique_ptr<int> key;
+    int order;
+};
+
+TEST(ParallelPrimitivesTest, MergeSortMovesAndStaysStable) {
+    ThreadPool pool(3);
+    int n = 50001;
+    std::vector<Ticket> tickets;
+    tickets.reserve(n);
+    unsigned seed = 7;
+    for (int i = 0; i < n; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        tickets.emplace_back(static_cast<int>(seed >> 24), i);  // many equal keys
+    }
+
+    parallelMergeSort(tickets.data(), n, [](const Ticket& a, const Ticket& b) {
+        return *a.key < *b.key;
+    }, pool);
+
+    for (int i = 1; i < n; ++i) {
+        ASSERT_NE(tickets[i].key, nullptr);
+        bool ordered = *tickets[i - 1].key < *tickets[i].key ||
+                       (*tickets[i - 1].key == *tickets[i].key && tickets[i - 1].order < tickets[i].order);
+        ASSERT_TRUE(ordered) << "at index " << i;
+    }
+}
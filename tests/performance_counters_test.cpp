@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <iostream>
+#include "performance_counters.h"
+
+// Helper: capture stdout from performanceCounters()
+static std::string captureOutput() {
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    performanceCounters();
+    std::cout.rdbuf(oldCout);
+    return buffer.str();
+}
+
+// ==================== 1. Opening Counters ====================
+
+TEST(PerformanceCountersTest, CounterStatusReported) {
+    std::string output = captureOutput();
+    bool available = output.find("Hardware counters: available") != std::string::npos;
+    bool fallback = output.find("Hardware counters: unavailable (") != std::string::npos &&
+                    output.find("), timing only") != std::string::npos;
+    EXPECT_TRUE(available || fallback)
+        << "Should report whether counters opened, or fall back to timing only";
+}
+
+// ==================== 2. Spine vs Flat Traversal ====================
+
+TEST(PerformanceCountersTest, BothLayoutsMeasured) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("  spine traversal") != std::string::npos);
+    EXPECT_TRUE(output.find("  flat traversal") != std::string::npos);
+    EXPECT_TRUE(output.find("Traversal sums match") != std::string::npos)
+        << "Both layouts should hold the same values";
+}
+
+// ==================== 3. Doubling Resize ====================
+
+TEST(PerformanceCountersTest, ResizeMeasured) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("  doubling resize") != std::string::npos);
+    EXPECT_TRUE(output.find("Appended 1048576 ints with 18 resizes (final capacity=1048576)") != std::string::npos)
+        << "Doubling from 4 to 2^20 should take 18 resizes";
+}
+
+// ==================== PerfCounters ====================
+
+TEST(PerfCountersTest, ReportMatchesAvailability) {
+    PerfCounters counters;
+    volatile long long sink = 0;  // 0 + 1 + ... + 99999 overflows int
+    PerfReport report = measureRegion(counters, "loop", [&] {
+        for (int i = 0; i < 100000; ++i) sink = sink + i;
+    });
+    EXPECT_EQ(report.name, "loop");
+    EXPECT_GE(report.milliseconds, 0.0);
+    EXPECT_EQ(report.countersAvailable, counters.available());
+    if (!counters.available()) {
+        EXPECT_FALSE(counters.unavailableReason().empty());
+        EXPECT_EQ(report.cycles, -1);
+        EXPECT_EQ(report.ipc(), -1.0);
+    }
+}
+
+TEST(PerfCountersTest, ScaledCountHandlesMultiplexing) {
+    EXPECT_EQ(scaledCount(100, 1000, 1000), 100) << "Counted the whole time: no scaling";
+    EXPECT_EQ(scaledCount(100, 1000, 250), 400) << "Counted a quarter of the time: scale by 4";
+    EXPECT_EQ(scaledCount(0, 1000, 0), -1) << "Never scheduled: unmeasured, not zero";
+}
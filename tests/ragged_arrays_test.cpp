@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <iostream>
+#include "ragged_arrays.h"
+
+// Helper: capture stdout from raggedArrays()
+static std::string captureOutput() {
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    raggedArrays();
+    std::cout.rdbuf(oldCout);
+    return buffer.str();
+}
+
+// ==================== 1. Converting a Jagged int** Table ====================
+
+TEST(RaggedArraysTest, OffsetsArePrefixSums) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("Values: 1 2 3 4 5 6 7") != std::string::npos)
+        << "All rows should be stored back to back in one values buffer";
+    EXPECT_TRUE(output.find("Offsets: 0 1 5 7") != std::string::npos)
+        << "Offsets should be the running total of row lengths {1, 4, 2}";
+}
+
+TEST(RaggedArraysTest, JaggedRowsPrinted) {
+    std::string output = captureOutput();
+    auto pos = output.find("Ragged array:");
+    ASSERT_TRUE(pos != std::string::npos)
+        << "Should print the converted ragged array";
+    std::string section = output.substr(pos);
+    EXPECT_TRUE(section.find("Row 0: 1\n") != std::string::npos);
+    EXPECT_TRUE(section.find("Row 1: 2 3 4 5\n") != std::string::npos);
+    EXPECT_TRUE(section.find("Row 2: 6 7\n") != std::string::npos);
+}
+
+// ==================== 2. Building Row by Row ====================
+
+TEST(RaggedArraysTest, AppendRowDoublesCapacity) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("After 1 row:  (values=1, capacity=4)") != std::string::npos)
+        << "First row should allocate the starting capacity of 4";
+    EXPECT_TRUE(output.find("After 2 rows: (values=6, capacity=8)") != std::string::npos)
+        << "Second row should double capacity from 4 to 8";
+}
+
+// ==================== 3. Spine vs Offsets ====================
+
+TEST(RaggedArraysTest, BenchmarkChecksumsMatch) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("Spine + rows:    20001 allocations") != std::string::npos)
+        << "Spine layout should need one allocation per row plus the spine";
+    EXPECT_TRUE(output.find("Checksums match") != std::string::npos)
+        << "Iterating both layouts should visit the same values";
+}
+
+// ==================== RaggedArray<T> ====================
+
+TEST(RaggedArrayTest, BulkBuildAllocatesExactly) {
+    int row0[] = {1, 2};
+    int row1[] = {3};
+    int* rows[] = {row0, row1};
+    int lengths[] = {2, 1};
+    RaggedArray<int> ragged(rows, lengths, 2);
+    EXPECT_EQ(ragged.rowCount(), 2);
+    EXPECT_EQ(ragged.valueCapacity(), 3);
+    EXPECT_EQ(ragged.offsetCapacity(), 3);
+    EXPECT_EQ(ragged.row(1)[0], 3);
+}
+
+TEST(RaggedArrayTest, EmptyRowsAndMove) {
+    RaggedArray<int> ragged;
+    int values[] = {4, 5};
+    ragged.appendRow(values, 0);
+    ragged.appendRow(values, 2);
+    RaggedArray<int> moved(std::move(ragged));
+    EXPECT_EQ(ragged.rowCount(), 0);
+    ASSERT_EQ(moved.rowCount(), 2);
+    EXPECT_EQ(moved.rowLength(0), 0);
+    EXPECT_EQ(moved.row(1)[1], 5);
+}
+
+TEST(RaggedArrayTest, AppendOwnRowAcrossResize) {
+    RaggedArray<int> ragged;
+    int values[] = {1, 2, 3, 4};
+    ragged.appendRow(values, 4);
+    ASSERT_EQ(ragged.valueCapacity(), 4);
+    ragged.appendRow(ragged.row(0));  // must grow: the source row moves
+    EXPECT_EQ(ragged.valueCapacity(), 8);
+    ASSERT_EQ(ragged.rowLength(1), 4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(ragged.row(1)[i], values[i]);
+    }
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <iostream>
+#include "shrinking_arrays.h"
+
+// Helper: capture stdout from shrinkingArrays()
+static std::string captureOutput() {
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    shrinkingArrays();
+    std::cout.rdbuf(oldCout);
+    return buffer.str();
+}
+
+// ==================== 1. Shrink at 1/4 Full ====================
+
+TEST(ShrinkingArraysTest, HysteresisShrink) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("After 16 pushes:  (count=16, capacity=16)") != std::string::npos);
+    EXPECT_TRUE(output.find("Popped to 4:      (count=4, capacity=16)") != std::string::npos)
+        << "Exactly 1/4 full should not shrink yet";
+    EXPECT_TRUE(output.find("Popped to 3:      (count=3, capacity=8)") != std::string::npos)
+        << "Below 1/4 full should halve capacity";
+    EXPECT_TRUE(output.find("Pushed to 5:      (count=5, capacity=8)") != std::string::npos)
+        << "Pushing back should not regrow right away";
+}
+
+// ==================== 2. Large Buffers ====================
+
+TEST(ShrinkingArraysTest, LargeBufferDrained) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("Big array: count=1048576") != std::string::npos);
+    EXPECT_TRUE(output.find("First element still 0, last kept 999") != std::string::npos)
+        << "Shrinking must keep the elements that are still in use";
+}
+
+// ==================== 3. Process-Wide Trim ====================
+
+TEST(ShrinkingArraysTest, TrimAll) {
+    std::string output = captureOutput();
+    EXPECT_TRUE(output.find("trimAllArrays() released") != std::string::npos);
+    EXPECT_TRUE(output.find("Spare after trim:  (count=100, capacity=100)") != std::string::npos)
+        << "Trim should shrink capacity down to count";
+}
+
+// ==================== ShrinkableArray ====================
+
+TEST(ShrinkableArrayTest, MadviseShrinkKeepsBufferAndRegrows) {
+    ShrinkableArray arr;
+    int n = 1 << 19;
+    for (int i = 0; i < n; ++i) arr.push(i);
+    std::size_t peak = arr.committedBytes();
+    while (arr.count() > 10) arr.pop();
+    EXPECT_LT(arr.committedBytes(), peak);
+    for (int i = 10; i < n; ++i) arr.push(i);
+    EXPECT_EQ(arr.capacity(), n);
+    for (int i = 0; i < n; i += 4099) {
+        ASSERT_EQ(arr[i], i);
+    }
+}
+
+TEST(ShrinkableArrayTest, GrowOnlyPolicyNeverShrinks) {
+    ShrinkPolicy policy;
+    policy.lowWaterRatio = 0.0;
+    ShrinkableArray arr(policy);
+    for (int i = 0; i < 64; ++i) arr.push(i);
+    arr.clear();
+    EXPECT_EQ(arr.capacity(), 64);
+}
+
+TEST(ShrinkableArrayTest, RegistryTracksLifetime) {
+    int before = registeredArrayCount();
+    {
+        ShrinkableArray a;
+        ShrinkableArray b;
+        EXPECT_EQ(registeredArrayCount(), before + 2);
+    }
+    EXPECT_EQ(registeredArrayCount(), before);
+}